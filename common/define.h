@@ -25,6 +25,45 @@
 // 参数错误
 #define PAR_ERROR -2
 
+// 链表存储模式(uolist_create_ex 的 flags 参数, 可按位或组合)
+#define UOLIST_DEFAULT 0x00         // 节点与数据域分别申请
+#define UOLIST_INLINE  0x01         // 数据域内联在节点之后, 一次申请
+#define UOLIST_POOL    0x02         // 节点从链表私有的内存池中分配(隐含 UOLIST_INLINE)
+#define UOLIST_ARENA   0x04         // 在内存池基础上, uolist_destroy 整体释放内存池(隐含 UOLIST_POOL)
+#define UOLIST_UNROLLED 0x08        // 展开链表: 每个节点存储多个数据(与其他存储模式互斥)
+#define UOLIST_SKIPLIST 0x10        // 附加跳表索引, 按索引访问为 O(log n)(不可与 UOLIST_UNROLLED 组合)
+#define UOLIST_CONCURRENT 0x20      // 附加读写锁, 公开函数可在多个线程中同时调用(可与其他模式组合)
+
+// 内存池每次向系统申请的块大小(字节)
+#define POOL_CHUNK_SIZE (64 * 1024)
+
+// 展开链表单个节点的目标大小(字节, 约 4 个缓存行)
+#define UNROLL_BLOCK_SIZE 256
+
+// 跳表索引的最大层数(每层节点数约为下一层的 1/4)
+#define SKIP_MAX_LEVEL 16
+
+// 无锁链表的节点回收方式(lflist_create_ex 的 flags 参数)
+#define LFLIST_EPOCH  0x00          // 纪元回收: 读者开销最小, 有线程停顿时待回收节点无上限
+#define LFLIST_HAZARD 0x01          // 风险指针: 待回收节点数有上限, 每访问一个节点多一次内存屏障
+
+// 无锁链表每个线程摘除多少个节点后尝试推进全局纪元
+#define EPOCH_RETIRE_BATCH 64
+
+// 无锁链表回收所用线程记录的状态
+#define LFREC_ACTIVE 0              // 所属线程仍在运行
+#define LFREC_IDLE   1              // 所属线程已退出, 可被其他线程接管
+#define LFREC_BUSY   2              // 其他线程正在代为回收其中的节点
+
+// 每个线程的风险指针个数(前驱及当前节点)
+#define HAZARD_PER_THREAD 2
+
+// 每个线程待回收节点数的扫描阈值下限(阈值不小于全部风险指针个数的 2 倍)
+#define HAZARD_RETIRE_BATCH 64
+
+// 缓存行大小(字节), 无锁队列的头尾指针分别独占缓存行
+#define CACHE_LINE_SIZE 64
+
 
 
 
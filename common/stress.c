@@ -0,0 +1,443 @@
+/*
+ * 无锁链表、无锁队列及读写锁链表的多线程压力测试(make stress)
+ * 建议配合检测工具运行, 例如:
+ *     make clean && make stress CFLAGS="-pthread -g -O1 -fsanitize=thread"
+ *     make clean && make stress CFLAGS="-pthread -g -O1 -fsanitize=address"
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <sched.h>
+#include <pthread.h>
+#include "uni_oneway_linkedlist.h"
+#include "uolist_lockfree.h"
+#include "uolist_queue.h"
+
+// 每个线程的操作次数
+#define STRESS_OPS 20000
+// 关键字范围
+#define STRESS_KEY_RANGE 64
+// 工作线程数
+#define STRESS_THREAD 6
+// 短生命周期线程的个数
+#define STRESS_CHURN 200
+
+// 检查失败时输出位置并计数
+#define CHECK(cond) do { if (!(cond)) { printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); __atomic_add_fetch(&failed, 1, __ATOMIC_RELAXED); } } while (0)
+
+static int failed = 0;
+
+/* 带外部资源的数据: 用于检查销毁函数恰好调用一次, 且不会访问已释放的数据 */
+typedef struct _item_t
+{
+    int key;
+    char *tag;                      // 存活期间指向 "x"
+}item_t;
+
+static long live = 0;               // 尚未销毁的数据个数
+
+/* 三路比较函数(同时检查数据未被销毁) */
+static int item_order(void *data, void *key)
+{
+    item_t *a = (item_t *)data;
+    item_t *b = (item_t *)key;
+
+    CHECK(NULL != a->tag && 'x' == a->tag[0]);
+    return (a->key > b->key) - (a->key < b->key);
+}
+
+/* 关键字比较函数 */
+static int item_compare(void *data, void *key)
+{
+    return (((item_t *)data)->key == ((item_t *)key)->key) ? MATCH_SUCCESS : MATCH_FAIL;
+}
+
+/* 销毁函数 */
+static int item_destroy(void *data)
+{
+    item_t *a = (item_t *)data;
+
+    a->tag[0] = 0;
+    free(a->tag);
+    a->tag = NULL;
+    __atomic_sub_fetch(&live, 1, __ATOMIC_RELAXED);
+    return 0;
+}
+
+/* 整数的关键字比较函数 */
+static int data_compare(void *data, void *key)
+{
+    return (*(int *)data == *(int *)key) ? MATCH_SUCCESS : MATCH_FAIL;
+}
+
+/* 遍历时检查升序 */
+static __thread int last = 0;
+static int item_check(void *data)
+{
+    CHECK(((item_t *)data)->key >= last);
+    last = ((item_t *)data)->key;
+    return 0;
+}
+
+
+/* 无锁链表: 随机插入、删除、获取, 部分线程反复遍历 */
+static void *__list_worker(void *arg)
+{
+    lflist_t *lf = ((void **)arg)[0];
+    unsigned int seed = (unsigned int)(long)((void **)arg)[1];
+    item_t v, o;
+    int i = 0;
+
+    for (i = 0; i < STRESS_OPS; i++)
+    {
+        v.key = rand_r(&seed) % STRESS_KEY_RANGE;
+        switch (rand_r(&seed) % 4)
+        {
+        case 0:
+            v.tag = (char *)malloc(2);
+            v.tag[0] = 'x';
+            v.tag[1] = 0;
+            __atomic_add_fetch(&live, 1, __ATOMIC_RELAXED);
+            lflist_insert(lf, &v);
+            break;
+        case 1:
+            lflist_delete_by_key(lf, &v, item_compare);
+            break;
+        case 2:
+            if (0 == lflist_retrieve_by_key(lf, &o, &v, item_compare))
+            {
+                CHECK(o.key == v.key);
+            }
+            break;
+        default:
+            if (i % 64 == 0)
+            {
+                last = -1;
+                CHECK(0 == lflist_traverse(lf, item_check));
+            }
+            break;
+        }
+    }
+
+    return NULL;
+}
+
+/* 无锁链表: 数据在销毁前不被释放, 销毁后全部释放 */
+static void __stress_list(int flags, const char *name)
+{
+    pthread_t tid[STRESS_THREAD];
+    void *arg[STRESS_THREAD][2];
+    lflist_t *lf = NULL;
+    int i = 0;
+
+    lf = lflist_create_ex(sizeof(item_t), item_destroy, item_order, flags);
+    for (i = 0; i < STRESS_THREAD; i++)
+    {
+        arg[i][0] = lf;
+        arg[i][1] = (void *)(long)(i + 1);
+        pthread_create(&tid[i], NULL, __list_worker, arg[i]);
+    }
+    for (i = 0; i < STRESS_THREAD; i++)
+    {
+        pthread_join(tid[i], NULL);
+    }
+    printf("%s: count = %d, live = %ld\n", name, lflist_get_count(lf), live);
+    lflist_destroy(&lf);
+    CHECK(0 == live);
+}
+
+
+/* 短生命周期线程: 首次访问时注册线程记录, 少量获取后退出 */
+static void *__short_reader(void *arg)
+{
+    item_t v, o;
+    int i = 0;
+
+    for (i = 0; i < 16; i++)
+    {
+        v.key = i * 4 % STRESS_KEY_RANGE;
+        if (0 == lflist_retrieve_by_key((lflist_t *)arg, &o, &v, item_compare))
+        {
+            CHECK(o.key == v.key);
+        }
+    }
+
+    return NULL;
+}
+
+/* 不断创建短生命周期线程 */
+static void *__spawner(void *arg)
+{
+    pthread_t tid;
+    int i = 0;
+
+    for (i = 0; i < STRESS_CHURN; i++)
+    {
+        pthread_create(&tid, NULL, __short_reader, arg);
+        pthread_join(tid, NULL);
+    }
+
+    return NULL;
+}
+
+/* 线程记录个数 */
+static int __rec_count(lflist_t *lf)
+{
+    epoch_rec_t *rec = NULL;
+    int n = 0;
+
+    if (LFLIST_HAZARD == lf->flags)
+    {
+        return lf->hzd.nrec;
+    }
+    for (rec = lf->ebr.recs; NULL != rec; rec = rec->next)
+    {
+        n++;
+    }
+
+    return n;
+}
+
+/*
+ * 线程的加入与退出与其他线程的插入、删除(及回收扫描)同时进行;
+ * 已退出线程的记录被接管, 记录个数不超过同时运行的线程数
+ */
+static void __stress_churn(int flags, const char *name)
+{
+    pthread_t tid[STRESS_THREAD];
+    void *arg[STRESS_THREAD][2];
+    lflist_t *lf = NULL;
+    int i = 0;
+
+    lf = lflist_create_ex(sizeof(item_t), item_destroy, item_order, flags);
+    for (i = 0; i < STRESS_THREAD; i++)
+    {
+        arg[i][0] = lf;
+        arg[i][1] = (void *)(long)(i + 100);
+        if (i < 2)
+        {
+            pthread_create(&tid[i], NULL, __spawner, lf);
+        }
+        else
+        {
+            pthread_create(&tid[i], NULL, __list_worker, arg[i]);
+        }
+    }
+    for (i = 0; i < STRESS_THREAD; i++)
+    {
+        pthread_join(tid[i], NULL);
+    }
+    printf("%s churn: count = %d, live = %ld, records = %d\n", name, lflist_get_count(lf), live, __rec_count(lf));
+    CHECK(__rec_count(lf) <= STRESS_THREAD);
+    lflist_destroy(&lf);
+    CHECK(0 == live);
+}
+
+
+static int counted = 0;
+
+/* 加共享锁的读操作 */
+static void *__shared_reader(void *arg)
+{
+    CHECK(get_count((uolist_t *)arg) > 0);
+    __atomic_store_n(&counted, 1, __ATOMIC_RELEASE);
+
+    return NULL;
+}
+
+/* 读写锁链表: 使索引失效的修改之后, 读操作仍可同时持有共享锁 */
+static void __stress_rwlock(void)
+{
+    pthread_t tid;
+    uolist_t *uo = NULL;
+    int i = 0;
+
+    uo = uolist_create_ex(sizeof(int), NULL, UOLIST_SKIPLIST | UOLIST_CONCURRENT);
+    for (i = 0; i < 100; i++)
+    {
+        uolist_append(uo, &i);
+    }
+    i = 5;
+    uolist_delete_by_key(uo, &i, data_compare);
+
+    uolist_lock_read(uo);
+    pthread_create(&tid, NULL, __shared_reader, uo);
+    for (i = 0; i < 1000 && !__atomic_load_n(&counted, __ATOMIC_ACQUIRE); i++)
+    {
+        usleep(1000);
+    }
+    CHECK(1 == __atomic_load_n(&counted, __ATOMIC_ACQUIRE));
+    CHECK(51 == *(int *)uolist_borrow_by_index(uo, 50));
+    uolist_unlock(uo);
+    pthread_join(tid, NULL);
+    printf("rwlock: shared = %d\n", counted);
+
+    uolist_destroy(uo);
+    head_destroy(&uo);
+}
+
+
+/* 计数数据: 关键字不变, 只修改计数 */
+typedef struct _counter_t
+{
+    int key;
+    int val;
+}counter_t;
+
+/* 关键字的哈希函数 */
+static unsigned int counter_hash(void *data)
+{
+    return (unsigned int)((counter_t *)data)->key;
+}
+
+/* 关键字比较函数 */
+static int counter_compare(void *data, void *key)
+{
+    return (((counter_t *)data)->key == ((counter_t *)key)->key) ? MATCH_SUCCESS : MATCH_FAIL;
+}
+
+/* 持有共享锁时借用各自的节点(误用): 只使哈希索引失效, 不在共享锁下重建 */
+static void *__borrow_worker(void *arg)
+{
+    uolist_t *uo = ((void **)arg)[0];
+    counter_t key = {(int)(long)((void **)arg)[1], 0};
+    counter_t *c = NULL;
+    int i = 0;
+
+    for (i = 0; i < STRESS_OPS / 10; i++)
+    {
+        uolist_lock_read(uo);
+        c = (counter_t *)uolist_borrow_mut_by_key(uo, &key, counter_compare);
+        CHECK(NULL != c && key.key == c->key);
+        if (NULL != c)
+        {
+            c->val++;
+        }
+        uolist_unlock(uo);
+    }
+
+    return NULL;
+}
+
+/* 读写锁链表: 附加哈希索引后, 在共享锁下借用可写数据 */
+static void __stress_borrow(void)
+{
+    pthread_t tid[STRESS_THREAD];
+    void *arg[STRESS_THREAD][2];
+    uolist_t *uo = NULL;
+    counter_t c = {0, 0};
+    int i = 0;
+
+    uo = uolist_create_ex(sizeof(counter_t), NULL, UOLIST_INLINE | UOLIST_CONCURRENT);
+    for (c.key = 0; c.key < STRESS_KEY_RANGE; c.key++)
+    {
+        uolist_append(uo, &c);
+    }
+    CHECK(0 == uolist_hash_attach(uo, counter_hash, counter_compare));
+
+    for (i = 0; i < STRESS_THREAD; i++)
+    {
+        arg[i][0] = uo;
+        arg[i][1] = (void *)(long)(i * 7);
+        pthread_create(&tid[i], NULL, __borrow_worker, arg[i]);
+    }
+    for (i = 0; i < STRESS_THREAD; i++)
+    {
+        pthread_join(tid[i], NULL);
+    }
+
+    // 之后的操作重建索引, 查找结果不变
+    for (i = 0; i < STRESS_THREAD; i++)
+    {
+        c.key = i * 7;
+        CHECK(0 == uolist_retrieve_by_key(uo, &c, &c, counter_compare));
+        CHECK(i * 7 == c.key && STRESS_OPS / 10 == c.val);
+    }
+    printf("borrow: val = %d\n", c.val);
+
+    uolist_destroy(uo);
+    head_destroy(&uo);
+}
+
+
+static lfqueue_t *queue = NULL;
+static int popped = 0;
+static int seen[STRESS_THREAD / 2 * STRESS_OPS];
+
+/* 无锁队列生产者 */
+static void *__producer(void *arg)
+{
+    int id = (int)(long)arg;
+    int v = 0;
+    int i = 0;
+
+    for (i = 0; i < STRESS_OPS; i++)
+    {
+        v = id * STRESS_OPS + i;
+        CHECK(0 == lfqueue_push(queue, &v));
+    }
+
+    return NULL;
+}
+
+/* 无锁队列消费者: 同一生产者的数据按入队顺序出队 */
+static void *__consumer(void *arg)
+{
+    int next[STRESS_THREAD / 2] = {0};
+    int v = 0;
+
+    while (__atomic_load_n(&popped, __ATOMIC_RELAXED) < STRESS_THREAD / 2 * STRESS_OPS)
+    {
+        if (0 != lfqueue_pop(queue, &v))
+        {
+            sched_yield();
+            continue;
+        }
+        CHECK(v % STRESS_OPS >= next[v / STRESS_OPS]);
+        next[v / STRESS_OPS] = v % STRESS_OPS + 1;
+        __atomic_add_fetch(&seen[v], 1, __ATOMIC_RELAXED);
+        __atomic_add_fetch(&popped, 1, __ATOMIC_RELAXED);
+    }
+
+    return NULL;
+}
+
+/* 无锁队列: 每个数据恰好出队一次 */
+static void __stress_queue(void)
+{
+    pthread_t tid[STRESS_THREAD];
+    int i = 0;
+
+    queue = lfqueue_create(sizeof(int), NULL);
+    for (i = 0; i < STRESS_THREAD / 2; i++)
+    {
+        pthread_create(&tid[i], NULL, __producer, (void *)(long)i);
+        pthread_create(&tid[STRESS_THREAD / 2 + i], NULL, __consumer, NULL);
+    }
+    for (i = 0; i < STRESS_THREAD; i++)
+    {
+        pthread_join(tid[i], NULL);
+    }
+    for (i = 0; i < STRESS_THREAD / 2 * STRESS_OPS; i++)
+    {
+        CHECK(1 == seen[i]);
+    }
+    CHECK(1 == lfqueue_is_empty(queue));
+    printf("queue: popped = %d\n", popped);
+    lfqueue_destroy(&queue);
+}
+
+
+int main(int argc, char **argv)
+{
+    __stress_list(LFLIST_EPOCH, "epoch");
+    __stress_list(LFLIST_HAZARD, "hazard");
+    __stress_churn(LFLIST_EPOCH, "epoch");
+    __stress_churn(LFLIST_HAZARD, "hazard");
+    __stress_queue();
+    __stress_rwlock();
+    __stress_borrow();
+
+    printf("%s\n", failed ? "FAILED" : "PASSED");
+    return failed ? 1 : 0;
+}
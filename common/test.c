@@ -1,6 +1,8 @@
 /* 普通存储(int)变量测试代码 */
 #include <stdio.h>
 #include "uni_oneway_linkedlist.h"
+#include "uolist_lockfree.h"
+#include "uolist_queue.h"
 
 /* 自定义节点中数据域销毁函数 */
 int node_destroy(void *data)
@@ -10,6 +12,14 @@ int node_destroy(void *data)
     return 0;
 }
 
+/* 自定义数据域资源释放函数(数据域在节点空间中, 只计数不 free) */
+int release_count = 0;
+int data_release(void *data)
+{
+    release_count++;
+    return 0;
+}
+
 /* 自定义数据域打印函数 */
 int data_print(void *data)
 {
@@ -17,6 +27,25 @@ int data_print(void *data)
     return 0;
 }
 
+/* 自定义数据域更新函数 */
+int data_increase(void *data)
+{
+    (*(int *)data)++;
+    return 0;
+}
+
+/* 自定义三路比较函数 */
+int data_order(void *data, void *key)
+{
+    return (*(int *)data > *(int *)key) - (*(int *)data < *(int *)key);
+}
+
+/* 自定义基数排序关键字提取函数(符号位取反, 负数排在前面) */
+unsigned long long data_key(void *data)
+{
+    return (unsigned int)*(int *)data ^ 0x80000000u;
+}
+
 /* 自定义关键字比较函数 */
 int data_compare(void *data, void *key)
 {
@@ -30,11 +59,30 @@ int data_compare(void *data, void *key)
     }
 }
 
+/* 自定义哈希函数(与 data_compare 配套) */
+unsigned int data_hash(void *data)
+{
+    return (unsigned int)*(int *)data;
+}
+
 
 int main(int argc, char **argv)
 {
     uolist_t *index = NULL;
     uolist_t *head = NULL;
+    uolist_t *inline_head = NULL;
+    uolist_t *pool_head = NULL;
+    uolist_t *arena_head = NULL;
+    uolist_t *unrolled_head = NULL;
+    uolist_t *skip_head = NULL;
+    uolist_t *sorted_head = NULL;
+    uolist_t *tail_head = NULL;
+    lflist_t *lf_head = NULL;
+    lfqueue_t *queue = NULL;
+    uolist_cursor_t it;
+    op_t arena_destroy[2] = {NULL, data_release};
+    int arr[5] = {1, 2, 3, 4, 5};
+    int *pdata = NULL;
     int i = 0;
     int j = 0;
     int temp = 0;
@@ -84,6 +132,9 @@ int main(int argc, char **argv)
     uolist_retrieve_by_index(head, &temp, 6);
     printf("temp = %d\n", temp);
 
+    // 链表根据索引借用数据(不拷贝)
+    printf("borrow = %d\n", *(const int *)uolist_borrow_by_index(head, 6));
+
     // 链表的遍历
     printf("count = %d\n", get_count(head));
     uolist_traverse(head, data_print);
@@ -144,9 +195,19 @@ int main(int argc, char **argv)
     uolist_traverse(head, data_print);
     printf("==================================================\n");
 
-    // 链表根据关键字删除所有的节点
+    // 链表根据关键字原地更新所有的节点
     key = 555;
-    uolist_delete_all_by_key(head, &key, data_compare);
+    uolist_update_all_by_key(head, &key, data_compare, data_increase);
+
+    // 链表的遍历
+    printf("count = %d\n", get_count(head));
+    uolist_traverse(head, data_print);
+    printf("==================================================\n");
+
+    // 链表根据关键字删除所有的节点
+    key = 556;
+    temp = uolist_delete_all_by_key(head, &key, data_compare);
+    printf("delete num = %d\n", temp);
 
     // 链表的遍历
     printf("count = %d\n", get_count(head));
@@ -161,7 +222,224 @@ int main(int argc, char **argv)
     uolist_traverse(head, data_print);
     printf("==================================================\n");
 
+    // 链表的排序(稳定, 只重新连接节点)
+    uolist_sort(head, data_order);
+
+    // 链表的遍历
+    printf("count = %d\n", get_count(head));
+    uolist_traverse(head, data_print);
+    printf("==================================================\n");
+
+    // 链表的基数排序
+    uolist_reverse(head);
+    uolist_radix_sort(head, data_key);
+
+    // 链表的遍历
+    printf("count = %d\n", get_count(head));
+    uolist_traverse(head, data_print);
+    printf("==================================================\n");
+
+    // 根据关键字定位游标并修改
+    key = 666;
+    if (0 == uolist_find_by_key(head, &key, data_compare, &it))
+    {
+        temp = 6;
+        uolist_cursor_set(&it, &temp);
+    }
+
+    // 游标顺序编辑: 删除偶数, 在奇数之后插入其 10 倍
+    uolist_cursor_init(&it, head);
+    while (0 == uolist_cursor_get(&it, &temp))
+    {
+        if (0 == temp % 2)
+        {
+            uolist_cursor_erase(&it);
+            continue;
+        }
+        temp *= 10;
+        uolist_cursor_insert_after(&it, &temp);
+        uolist_cursor_next(&it);
+        uolist_cursor_next(&it);
+    }
+
+    // 链表的遍历
+    printf("count = %d\n", get_count(head));
+    uolist_traverse(head, data_print);
+    printf("==================================================\n");
+
+    // 内联存储模式(int 无需自定义销毁函数)
+    inline_head = uolist_create_ex(sizeof(int), NULL, UOLIST_INLINE);
+
+    // 由连续数组批量尾部插入
+    uolist_append_bulk(inline_head, arr, 5);
+    key = 3;
+    uolist_delete_by_key(inline_head, &key, data_compare);
+
+    // 链表的遍历
+    printf("count = %d\n", get_count(inline_head));
+    uolist_traverse(inline_head, data_print);
+    printf("==================================================\n");
+
+    // 内存池模式(删除的节点被后续插入复用)
+    pool_head = uolist_create_ex(sizeof(int), NULL, UOLIST_POOL);
+    for (i = 1; i <= 5; i++)
+    {
+        uolist_append(pool_head, &i);
+    }
+    uolist_delete_by_index(pool_head, 0);
+    temp = 6;
+    uolist_append(pool_head, &temp);
+
+    // 尾部原地构造插入(直接写入节点数据域)
+    *(int *)uolist_emplace_append(pool_head) = 7;
+
+    // 链表的遍历
+    printf("count = %d\n", get_count(pool_head));
+    uolist_traverse(pool_head, data_print);
+    printf("==================================================\n");
+
+    // 导出到新申请的连续空间
+    pdata = uolist_to_array(pool_head, NULL, 0);
+    printf("pdata[0] = %d, pdata[%d] = %d\n", pdata[0], get_count(pool_head) - 1, pdata[get_count(pool_head) - 1]);
+    free(pdata);
+    printf("==================================================\n");
+
+    // 整体释放模式(uolist_destroy 整体释放内存池, 之后链表可继续使用)
+    for (j = 0; j < 2; j++)
+    {
+        arena_head = uolist_create_ex(sizeof(int), arena_destroy[j], UOLIST_ARENA);
+        for (i = 1; i <= 5; i++)
+        {
+            uolist_append(arena_head, &i);
+        }
+        uolist_destroy(arena_head);
+        printf("count = %d, release = %d\n", get_count(arena_head), release_count);
+        uolist_append_bulk(arena_head, arr, 5);
+        uolist_traverse(arena_head, data_print);
+        head_destroy(&arena_head);
+    }
+    printf("release = %d\n", release_count);
+    printf("==================================================\n");
+
+    // 展开链表模式(接口与普通链表一致)
+    unrolled_head = uolist_create_ex(sizeof(int), NULL, UOLIST_UNROLLED);
+    for (i = 1; i <= 100; i++)
+    {
+        uolist_append(unrolled_head, &i);
+    }
+    temp = 1989;
+    uolist_insert_by_index(unrolled_head, &temp, 50);
+    key = 1989;
+    printf("index = %d\n", get_match_index(unrolled_head, &key, data_compare));
+    uolist_delete_by_index(unrolled_head, 50);
+    uolist_retrieve_by_index(unrolled_head, &temp, 99);
+    printf("count = %d, temp = %d\n", get_count(unrolled_head), temp);
+    printf("==================================================\n");
+
+    // 跳表索引(按索引访问为 O(log n))
+    skip_head = uolist_create_ex(sizeof(int), NULL, UOLIST_POOL | UOLIST_SKIPLIST);
+    for (i = 1; i <= 10000; i++)
+    {
+        uolist_append(skip_head, &i);
+    }
+    temp = 1989;
+    uolist_insert_by_index(skip_head, &temp, 5000);
+    uolist_delete_by_index(skip_head, 0);
+    uolist_retrieve_by_index(skip_head, &temp, 4999);
+    printf("count = %d, temp = %d\n", get_count(skip_head), temp);
+    printf("==================================================\n");
+
+    // 哈希索引(按关键字访问为 O(1))
+    uolist_hash_attach(skip_head, data_hash, data_compare);
+    key = 10000;
+    printf("index = %d\n", get_match_index(skip_head, &key, data_compare));
+    temp = 20000;
+    uolist_modify_by_key(skip_head, &temp, &key, data_compare);
+    uolist_delete_by_key(skip_head, &temp, data_compare);
+    printf("count = %d, index = %d\n", get_count(skip_head), get_match_index(skip_head, &temp, data_compare));
+    printf("==================================================\n");
+
+    // 多线程排序
+    uolist_reverse(skip_head);
+    uolist_parallel_sort(skip_head, data_order, 4);
+    uolist_retrieve_by_index(skip_head, &temp, 0);
+    printf("count = %d, temp = %d\n", get_count(skip_head), temp);
+    printf("==================================================\n");
+
+    // 有序模式
+    sorted_head = uolist_create_ex(sizeof(int), NULL, UOLIST_INLINE);
+    uolist_set_order(sorted_head, data_order);
+    for (i = 0; i < 5; i++)
+    {
+        temp = (i * 7) % 5;
+        uolist_insert_sorted(sorted_head, &temp);
+    }
+    uolist_traverse(sorted_head, data_print);
+    key = 3;
+    printf("index = %d\n", uolist_find_sorted(sorted_head, &key));
+    uolist_delete_sorted(sorted_head, &key);
+    printf("index = %d\n", uolist_find_sorted(sorted_head, &key));
+    printf("==================================================\n");
+
+    // 链表的拆分与拼接
+    tail_head = uolist_split_at(sorted_head, 2);
+    uolist_traverse(sorted_head, data_print);
+    uolist_traverse(tail_head, data_print);
+    uolist_concat(sorted_head, tail_head);
+    printf("count = %d, %d\n", get_count(sorted_head), get_count(tail_head));
+    head_destroy(&tail_head);
+    printf("==================================================\n");
+
+    // 并发模式: 借用数据时自行加共享锁
+    tail_head = uolist_create_ex(sizeof(int), NULL, UOLIST_CONCURRENT);
+    uolist_append_bulk(tail_head, arr, 5);
+    uolist_lock_read(tail_head);
+    pdata = (int *)uolist_borrow_by_index(tail_head, 4);
+    printf("*pdata = %d\n", *pdata);
+    uolist_unlock(tail_head);
+    uolist_destroy(tail_head);
+    head_destroy(&tail_head);
+    printf("==================================================\n");
+
+    // 无锁有序链表
+    lf_head = lflist_create(sizeof(int), NULL, data_order);
+    for (i = 0; i < 5; i++)
+    {
+        temp = (i * 3) % 5;
+        lflist_insert(lf_head, &temp);
+    }
+    key = 2;
+    lflist_delete_by_key(lf_head, &key, data_compare);
+    lflist_traverse(lf_head, data_print);
+    printf("count = %d\n", lflist_get_count(lf_head));
+    lflist_destroy(&lf_head);
+    printf("==================================================\n");
+
+    // 无锁队列
+    queue = lfqueue_create(sizeof(int), NULL);
+    for (i = 0; i < 5; i++)
+    {
+        lfqueue_push(queue, &i);
+    }
+    while (0 == lfqueue_pop(queue, &temp))
+    {
+        printf("%d ", temp);
+    }
+    printf("\nempty = %d\n", lfqueue_is_empty(queue));
+    lfqueue_destroy(&queue);
+    printf("==================================================\n");
+
     // 链表的释放
+    uolist_destroy(sorted_head);
+    head_destroy(&sorted_head);
+    uolist_destroy(skip_head);
+    head_destroy(&skip_head);
+    uolist_destroy(unrolled_head);
+    head_destroy(&unrolled_head);
+    uolist_destroy(pool_head);
+    head_destroy(&pool_head);
+    uolist_destroy(inline_head);
+    head_destroy(&inline_head);
     uolist_destroy(head);
     uolist_destroy(index);
     head_destroy(&head);
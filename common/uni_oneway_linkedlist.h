@@ -25,12 +25,16 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <pthread.h>
 #include "define.h"
 
 
 // 类型定义
 typedef int(*op_t)(void *data);
 typedef int(*cmp_t)(void *data, void *key);
+typedef unsigned int(*hash_t)(void *data);
+typedef int(*order_t)(void *data, void *key);
+typedef unsigned long long(*radix_t)(void *data);
 
 
 /**
@@ -40,22 +44,123 @@ typedef struct _node_t
 {
     void *data;                     // 数据域
     struct _node_t *next;           // 指针域
+    char payload[];                 // 内联数据域(仅 UOLIST_INLINE 模式使用)
 }node_t;
 
 
 
+/**
+ * @brief 展开链表节点定义
+ * @details 一个节点连续存放最多 cap 个数据, 查找时可在节点内顺序扫描
+ */
+typedef struct _unode_t
+{
+    struct _unode_t *next;          // 指针域
+    int fill;                       // 已存放的数据个数
+    int cap;                        // 最多存放的数据个数
+    char elems[];                   // 数据区
+}unode_t;
+
+
+
+/**
+ * @brief 跳表索引节点定义
+ * @details 跳表的最底层就是链表本身, 索引节点只构成其上的各层,
+ *          span 为到本层后继所跨越的链表节点数, 用于按索引定位
+ */
+typedef struct _sknode_t
+{
+    node_t *node;                   // 对应的链表节点(头索引节点为 NULL)
+    struct
+    {
+        struct _sknode_t *next;     // 本层的后继
+        int span;                   // 到本层后继的跨度
+    }lv[];                          // 各层信息
+}sknode_t;
+
+
+
+/**
+ * @brief 哈希索引表项定义
+ */
+typedef struct _hentry_t
+{
+    node_t *node;                   // 对应的链表节点
+    unsigned int hash;              // 节点数据的哈希值
+    struct _hentry_t *next;         // 同一桶中的下一个表项
+}hentry_t;
+
+
+
+/**
+ * @brief 哈希索引定义
+ * @details 以链地址法组织, 桶数为 2 的幂, 平均每桶不超过一个表项
+ */
+typedef struct _hindex_t
+{
+    hentry_t **buckets;             // 桶数组
+    int nbucket;                    // 桶的个数
+    int count;                      // 表项的个数
+    int dirty;                      // 索引是否失效(失效后在下次按关键字访问时重建)
+    hash_t my_hash;                 // 自定义哈希函数
+    cmp_t op_cmp;                   // 与哈希函数配套的比较函数
+}hindex_t;
+
+
+
+/**
+ * @brief 节点内存池定义
+ * @details 按固定大小(节点 + 数据)切分大块空间, 释放的节点
+ *          借用 next 指针串成空闲链表以便复用
+ */
+typedef struct _pool_t
+{
+    void *chunks;                   // 已申请的大块空间链表
+    node_t *free_list;              // 空闲节点链表
+    char *cur;                      // 当前大块中未分配空间的起始
+    char *end;                      // 当前大块的结束
+    size_t block_size;              // 单个节点块的大小
+}pool_t;
+
+
+
 /**
  * @brief 链表头信息结构体定义
  */
 typedef struct _uolist_t
 {
     node_t *fstnode_p;              // 指向链表的第一个节点
+    node_t *lstnode_p;              // 指向链表的最后一个节点
     int size;                       // 存储数据的类型大小
     int count;                      // 节点的个数
+    int flags;                      // 存储模式
     op_t my_destroy;                // 自定义销毁函数
+    pool_t pool;                    // 节点内存池(仅 UOLIST_POOL 模式使用)
+    unode_t *fstunode_p;            // 指向第一个展开节点(仅 UOLIST_UNROLLED 模式使用)
+    unode_t *lstunode_p;            // 指向最后一个展开节点(仅 UOLIST_UNROLLED 模式使用)
+    sknode_t *skhead;               // 跳表头索引节点(仅 UOLIST_SKIPLIST 模式使用)
+    int sklevel;                    // 跳表当前使用的层数
+    int skdirty;                    // 跳表索引是否失效(失效后在下次按索引访问时重建)
+    unsigned int skseed;            // 跳表层数随机数种子
+    hindex_t *hidx;                 // 哈希索引(由 uolist_hash_attach 附加)
+    order_t my_order;               // 三路比较函数(由 uolist_set_order 设置, 有序模式使用)
+    pthread_rwlock_t *lock;         // 读写锁(仅 UOLIST_CONCURRENT 模式使用)
+    int wrheld;                     // 是否持有独占锁(只由持有独占锁的线程修改)
 }uolist_t;
 
 
+/**
+ * @brief 链表游标定义
+ * @details 保存当前节点及其前驱, 顺序访问与修改均为 O(1)
+ */
+typedef struct _uolist_cursor_t
+{
+    uolist_t *uo;                   // 所属链表
+    node_t *prev;                   // 当前节点的前驱(当前节点为第一个节点时为 NULL)
+    node_t *cur;                    // 当前节点(NULL 表示已越过链表尾部)
+}uolist_cursor_t;
+
+
 /**
  * @brief           创建链表头信息结构体
  * @param           存储数据类型大小
@@ -65,6 +170,35 @@ typedef struct _uolist_t
 uolist_t *uolist_create(int size, op_t my_destroy);
 
 
+/**
+ * @brief           按指定存储模式创建链表头信息结构体
+ * @details         UOLIST_INLINE / UOLIST_POOL 模式下数据域与节点在同一块空间中,
+ *                  自定义销毁函数只负责释放数据内部引用的资源,
+ *                  不能 free 数据域本身; 无资源需要释放时可传 NULL.
+ *                  UOLIST_POOL 模式下删除的节点回收到内存池,
+ *                  内存池空间在 head_destroy 时统一释放.
+ *                  UOLIST_ARENA 模式下 uolist_destroy 不再逐个回收节点,
+ *                  而是整体释放内存池; 自定义销毁函数为 NULL 时无需遍历链表.
+ *                  UOLIST_UNROLLED 模式下数据连续存放在展开节点中(销毁函数约定同
+ *                  UOLIST_INLINE), 游标及 uolist_find_by_key 不可用.
+ *                  UOLIST_SKIPLIST 可与前三种模式组合, 头尾插入及按索引插入/删除时
+ *                  同步维护索引, 其余修改链表结构的操作使索引失效, 下次按索引
+ *                  访问时 O(n) 重建.
+ *                  UOLIST_CONCURRENT 可与其他模式组合, 附加读写锁: 只读函数加共享锁,
+ *                  修改链表的函数加独占锁. 游标、借用及原地构造函数不加锁,
+ *                  调用者须自行加锁: 只读的游标函数及 uolist_borrow_by_* 可在
+ *                  uolist_lock_read 下调用, 修改数据的游标函数、uolist_borrow_mut_by_*
+ *                  及原地构造函数只能在 uolist_lock_write 下调用;
+ *                  head_destroy 须在其他线程不再访问链表后调用
+ * @param           存储数据类型大小
+ * @param           自定义销毁数据函数
+ * @param           存储模式(UOLIST_DEFAULT / UOLIST_INLINE / UOLIST_POOL / UOLIST_ARENA /
+ *                  UOLIST_UNROLLED / UOLIST_SKIPLIST / UOLIST_CONCURRENT)
+ * @return          指向链表头信息结构体的指针
+ */
+uolist_t *uolist_create_ex(int size, op_t my_destroy, int flags);
+
+
 /**
  * @brief           链表头部插入
  * @param           头信息结构体的指针
@@ -99,7 +233,7 @@ int uolist_traverse(uolist_t *uo, op_t my_print);
 int uolist_destroy(uolist_t *uo);
 
 /**
- * @brief           头信息结构体销毁函数
+ * @brief           头信息结构体销毁函数(同时释放内存池空间)
  * @param           头信息结构体的指针的地址
  * @return          
  *      @arg  0:正常
@@ -235,32 +369,40 @@ int uolist_retrieve_by_key(uolist_t *uo, void *data, void *key, cmp_t op_cmp);
 
 
 /**
- * @brief           链表根据关键字删除所有匹配的节点
+ * @brief           链表根据关键字删除所有匹配的节点(单次遍历)
  * @param           头信息结构体的指针
  * @param           关键字
  * @param           自定义比较函数 
- * @return          
- *      @arg  0:正常
+ * @return          删除的节点个数
  *      @arg  PAR_ERROR:参数错误
- *      @arg  FUN_ERROR:函数错误
  */
 int uolist_delete_all_by_key(uolist_t *uo, void *key, cmp_t op_cmp);
 
 
 /**
- * @brief           链表根据关键字修改所有匹配节点的数据
+ * @brief           链表根据关键字修改所有匹配节点的数据(单次遍历)
  * @param           头信息结构体的指针
  * @param           修改的数据
  * @param           关键字
  * @param           自定义比较函数
- * @return          
- *      @arg  0:正常
+ * @return          修改的节点个数
  *      @arg  PAR_ERROR:参数错误
- *      @arg  FUN_ERROR:函数错误
  */
 int uolist_modify_all_by_key(uolist_t *uo, void *data, void *key, cmp_t op_cmp);
 
 
+/**
+ * @brief           链表根据关键字对所有匹配节点的数据原地调用自定义更新函数
+ * @param           头信息结构体的指针
+ * @param           关键字
+ * @param           自定义比较函数
+ * @param           自定义更新函数(参数为节点数据域)
+ * @return          更新的节点个数
+ *      @arg  PAR_ERROR:参数错误
+ */
+int uolist_update_all_by_key(uolist_t *uo, void *key, cmp_t op_cmp, op_t my_update);
+
+
 /**
  * @brief           自定义索引销毁函数
  * @param           数据域
@@ -291,6 +433,7 @@ int index_print(void *data);
 
 /**
  * @brief           链表的翻转
+ * @details         翻转后退出有序模式
  * @param           头信息结构体的指针
  * @return          
  *      @arg  PAR_ERROR: 参数错误
@@ -299,6 +442,433 @@ int index_print(void *data);
 int uolist_reverse(uolist_t *uo);
 
 
+/**
+ * @brief           游标初始化, 指向链表的第一个节点
+ * @param           游标的指针
+ * @param           头信息结构体的指针
+ * @return          
+ *      @arg  0:正常
+ *      @arg  PAR_ERROR:参数错误
+ */
+int uolist_cursor_init(uolist_cursor_t *it, uolist_t *uo);
+
+
+/**
+ * @brief           游标移动到下一个节点
+ * @param           游标的指针
+ * @return          
+ *      @arg  0:正常
+ *      @arg  PAR_ERROR:参数错误
+ *      @arg  FUN_ERROR:已越过链表尾部
+ */
+int uolist_cursor_next(uolist_cursor_t *it);
+
+
+/**
+ * @brief           获取游标所在节点的数据
+ * @param           游标的指针
+ * @param           获取的数据
+ * @return          
+ *      @arg  0:正常
+ *      @arg  PAR_ERROR:参数错误
+ *      @arg  FUN_ERROR:已越过链表尾部
+ */
+int uolist_cursor_get(uolist_cursor_t *it, void *data);
+
+
+/**
+ * @brief           修改游标所在节点的数据
+ * @param           游标的指针
+ * @param           修改的数据
+ * @return          
+ *      @arg  0:正常
+ *      @arg  PAR_ERROR:参数错误
+ *      @arg  FUN_ERROR:已越过链表尾部
+ */
+int uolist_cursor_set(uolist_cursor_t *it, void *data);
+
+
+/**
+ * @brief           在游标所在节点之后插入节点, 游标位置不变
+ * @details         游标已越过链表尾部时插入到链表尾部
+ * @param           游标的指针
+ * @param           插入的数据
+ * @return          
+ *      @arg  0:正常
+ *      @arg  PAR_ERROR:参数错误
+ *      @arg  FUN_ERROR:函数错误
+ */
+int uolist_cursor_insert_after(uolist_cursor_t *it, void *data);
+
+
+/**
+ * @brief           删除游标所在节点, 游标移动到被删除节点的下一个节点
+ * @param           游标的指针
+ * @return          
+ *      @arg  0:正常
+ *      @arg  PAR_ERROR:参数错误
+ *      @arg  FUN_ERROR:已越过链表尾部
+ */
+int uolist_cursor_erase(uolist_cursor_t *it);
+
+
+/**
+ * @brief           根据关键字查找匹配节点, 并将游标定位到该节点
+ * @details         游标同时保存匹配节点及其前驱, 后续的获取/修改/删除
+ *                  无需再次遍历链表
+ * @param           头信息结构体的指针
+ * @param           关键字
+ * @param           自定义比较函数
+ * @param           游标的指针
+ * @return          
+ *      @arg  0:正常
+ *      @arg  PAR_ERROR:参数错误
+ *      @arg  MATCH_FAIL:无匹配节点
+ */
+int uolist_find_by_key(uolist_t *uo, void *key, cmp_t op_cmp, uolist_cursor_t *it);
+
+
+/**
+ * @brief           根据索引借用节点数据(不拷贝)
+ * @details         返回的指针在链表下一次插入/删除/销毁之前有效
+ * @param           头信息结构体的指针
+ * @param           索引值
+ * @return          指向节点数据的只读指针
+ *      @arg  PAR_ERROR:参数错误
+ */
+const void *uolist_borrow_by_index(uolist_t *uo, int index);
+
+
+/**
+ * @brief           根据索引借用节点数据用于原地修改(不拷贝)
+ * @details         返回的指针在链表下一次插入/删除/销毁之前有效.
+ *                  UOLIST_CONCURRENT 模式下须持有 uolist_lock_write
+ * @param           头信息结构体的指针
+ * @param           索引值
+ * @return          指向节点数据的可写指针
+ *      @arg  PAR_ERROR:参数错误
+ */
+void *uolist_borrow_mut_by_index(uolist_t *uo, int index);
+
+
+/**
+ * @brief           根据关键字借用节点数据(不拷贝)
+ * @details         返回的指针在链表下一次插入/删除/销毁之前有效
+ * @param           头信息结构体的指针
+ * @param           关键字
+ * @param           自定义比较函数
+ * @return          指向节点数据的只读指针
+ *      @arg  PAR_ERROR:参数错误
+ *      @arg  NULL     :无匹配节点
+ */
+const void *uolist_borrow_by_key(uolist_t *uo, void *key, cmp_t op_cmp);
+
+
+/**
+ * @brief           根据关键字借用节点数据用于原地修改(不拷贝)
+ * @details         返回的指针在链表下一次插入/删除/销毁之前有效.
+ *                  UOLIST_CONCURRENT 模式下须持有 uolist_lock_write
+ * @param           头信息结构体的指针
+ * @param           关键字
+ * @param           自定义比较函数
+ * @return          指向节点数据的可写指针
+ *      @arg  PAR_ERROR:参数错误
+ *      @arg  NULL     :无匹配节点
+ */
+void *uolist_borrow_mut_by_key(uolist_t *uo, void *key, cmp_t op_cmp);
+
+
+/**
+ * @brief           链表头部原地构造插入
+ * @details         返回的数据空间未初始化, 由调用者直接写入
+ * @param           头信息结构体的指针
+ * @return          指向新节点数据域的指针
+ *      @arg  PAR_ERROR:参数错误
+ *      @arg  FUN_ERROR:函数错误
+ */
+void *uolist_emplace_prepend(uolist_t *uo);
+
+
+/**
+ * @brief           链表尾部原地构造插入
+ * @details         返回的数据空间未初始化, 由调用者直接写入
+ * @param           头信息结构体的指针
+ * @return          指向新节点数据域的指针
+ *      @arg  PAR_ERROR:参数错误
+ *      @arg  FUN_ERROR:函数错误
+ */
+void *uolist_emplace_append(uolist_t *uo);
+
+
+/**
+ * @brief           链表根据索引原地构造插入
+ * @details         返回的数据空间未初始化, 由调用者直接写入
+ * @param           头信息结构体的指针
+ * @param           索引值
+ * @return          指向新节点数据域的指针
+ *      @arg  PAR_ERROR:参数错误
+ *      @arg  FUN_ERROR:函数错误
+ */
+void *uolist_emplace_by_index(uolist_t *uo, int index);
+
+
+/**
+ * @brief           链表尾部批量插入
+ * @details         节点链构建完成后一次接到链表尾部, UOLIST_POOL 模式下只申请一次空间
+ * @param           头信息结构体的指针
+ * @param           连续存放的 n 个数据(每个数据 size 字节)
+ * @param           数据个数
+ * @return          
+ *      @arg  0:正常
+ *      @arg  PAR_ERROR:参数错误
+ *      @arg  FUN_ERROR:函数错误
+ */
+int uolist_append_bulk(uolist_t *uo, void *data, int n);
+
+
+/**
+ * @brief           链表头部批量插入
+ * @details         插入后数组中的数据依次位于索引 0 ~ n-1, UOLIST_POOL 模式下只申请一次空间
+ * @param           头信息结构体的指针
+ * @param           连续存放的 n 个数据(每个数据 size 字节)
+ * @param           数据个数
+ * @return          
+ *      @arg  0:正常
+ *      @arg  PAR_ERROR:参数错误
+ *      @arg  FUN_ERROR:函数错误
+ */
+int uolist_prepend_bulk(uolist_t *uo, void *data, int n);
+
+
+/**
+ * @brief           将链表全部数据依次导出到连续空间
+ * @details         传入空间为 NULL 时申请 count * size 字节的新空间(由调用者 free);
+ *                  预取距离大于 0 时提前预取之后第 n 个节点, 减少遍历时的缓存缺失
+ * @param           头信息结构体的指针
+ * @param           导出空间(至少 count * size 字节), 可为 NULL
+ * @param           预取距离(0 为不预取)
+ * @return          导出空间的指针(空链表且未传入空间时为 NULL)
+ *      @arg  PAR_ERROR:参数错误
+ *      @arg  FUN_ERROR:函数错误
+ */
+void *uolist_to_array(uolist_t *uo, void *buf, int prefetch);
+
+
+/**
+ * @brief           为链表附加哈希索引
+ * @details         之后以同一比较函数调用的按关键字删除/修改/获取/借用、
+ *                  get_match_index 及 uolist_find_by_key 先查哈希索引, 无匹配时
+ *                  不再遍历链表; 插入删除节点时同步维护索引. 哈希函数同时作用于
+ *                  节点数据和关键字, 要求比较匹配的数据与关键字哈希值相同.
+ *                  通过借用/就地构造接口或批量修改接口改写数据后索引失效,
+ *                  下次按关键字访问时 O(n) 重建. 已有索引时替换为新的索引.
+ *                  UOLIST_UNROLLED 模式不支持
+ * @param           头信息结构体的指针
+ * @param           自定义哈希函数
+ * @param           与哈希函数配套的比较函数
+ * @return          
+ *      @arg  0:正常
+ *      @arg  PAR_ERROR:参数错误
+ *      @arg  FUN_ERROR:函数错误
+ */
+int uolist_hash_attach(uolist_t *uo, hash_t my_hash, cmp_t op_cmp);
+
+
+/**
+ * @brief           移除链表的哈希索引
+ * @param           头信息结构体的指针
+ * @return          
+ *      @arg  0:正常
+ *      @arg  PAR_ERROR:参数错误
+ */
+int uolist_hash_detach(uolist_t *uo);
+
+
+/**
+ * @brief           设置三路比较函数, 进入有序模式
+ * @details         三路比较函数返回负数/0/正数分别表示数据小于/等于/大于关键字.
+ *                  链表必须已按该顺序排列(非递减), 之后由 uolist_insert_sorted
+ *                  插入即可保持有序; 其他插入及修改接口不检查顺序.
+ *                  UOLIST_SKIPLIST 模式下有序查找经跳表索引下降, 为 O(log n).
+ *                  UOLIST_UNROLLED 模式不支持
+ * @param           头信息结构体的指针
+ * @param           三路比较函数(为 NULL 时退出有序模式)
+ * @return          
+ *      @arg  0:正常
+ *      @arg  PAR_ERROR:参数错误
+ *      @arg  FUN_ERROR:函数错误(链表未按该顺序排列)
+ */
+int uolist_set_order(uolist_t *uo, order_t my_order);
+
+
+/**
+ * @brief           有序插入(插入到所有相等数据之后, 单次遍历)
+ * @param           头信息结构体的指针
+ * @param           插入节点数据
+ * @return          
+ *      @arg  0:正常
+ *      @arg  PAR_ERROR:参数错误
+ *      @arg  FUN_ERROR:函数错误
+ */
+int uolist_insert_sorted(uolist_t *uo, void *data);
+
+
+/**
+ * @brief           有序查找第一个等于关键字的索引(遇到更大的数据即停止)
+ * @param           头信息结构体的指针
+ * @param           关键字
+ * @return          索引值
+ *      @arg  PAR_ERROR:参数错误
+ *      @arg  MATCH_FAIL:无匹配索引
+ */
+int uolist_find_sorted(uolist_t *uo, void *key);
+
+
+/**
+ * @brief           有序获取第一个等于关键字的数据(遇到更大的数据即停止)
+ * @param           头信息结构体的指针
+ * @param           获取的数据
+ * @param           关键字
+ * @return          
+ *      @arg  0:正常
+ *      @arg  PAR_ERROR:参数错误
+ *      @arg  FUN_ERROR:无匹配数据
+ */
+int uolist_retrieve_sorted(uolist_t *uo, void *data, void *key);
+
+
+/**
+ * @brief           有序删除第一个等于关键字的数据(遇到更大的数据即停止)
+ * @param           头信息结构体的指针
+ * @param           关键字
+ * @return          
+ *      @arg  0:正常
+ *      @arg  PAR_ERROR:参数错误
+ *      @arg  FUN_ERROR:无匹配数据
+ */
+int uolist_delete_sorted(uolist_t *uo, void *key);
+
+
+/**
+ * @brief           稳定排序(自底向上的自然归并排序)
+ * @details         只重新连接节点, 不拷贝数据, 额外空间 O(1), 时间 O(n log n);
+ *                  已基本有序的数据以现有的非递减段为归并单位, 完全有序时为 O(n).
+ *                  以不同于 uolist_set_order 所设置的比较函数排序时退出有序模式.
+ *                  UOLIST_UNROLLED 模式不支持
+ * @param           头信息结构体的指针
+ * @param           三路比较函数(为 NULL 时使用 uolist_set_order 所设置的比较函数)
+ * @return          
+ *      @arg  0:正常
+ *      @arg  PAR_ERROR:参数错误
+ *      @arg  FUN_ERROR:函数错误
+ */
+int uolist_sort(uolist_t *uo, order_t my_order);
+
+
+/**
+ * @brief           基数排序(按无符号整数关键字升序, 稳定)
+ * @details         每轮按关键字的一个字节(节点较多时为两个字节)将节点分配到桶中
+ *                  再依次连接, 只重新连接节点, 不拷贝数据, 时间 O(n); 所有节点中
+ *                  完全相同的位不参与排序, 32 位或更小的关键字不会产生多余的轮数.
+ *                  有符号整数可将符号位取反后作为关键字. 排序后退出有序模式.
+ *                  UOLIST_UNROLLED 模式不支持
+ * @param           头信息结构体的指针
+ * @param           自定义关键字提取函数
+ * @return          
+ *      @arg  0:正常
+ *      @arg  PAR_ERROR:参数错误
+ *      @arg  FUN_ERROR:函数错误
+ */
+int uolist_radix_sort(uolist_t *uo, radix_t my_key);
+
+
+/**
+ * @brief           多线程稳定排序
+ * @details         将链表切分为每个线程一段, 各段并行进行自然归并排序, 再按二叉树
+ *                  两两并行归并(只重新连接节点). 节点较少时退化为 uolist_sort.
+ *                  比较函数会在多个线程中同时调用, 须为线程安全的.
+ *                  以不同于 uolist_set_order 所设置的比较函数排序时退出有序模式.
+ *                  UOLIST_UNROLLED 模式不支持
+ * @param           头信息结构体的指针
+ * @param           三路比较函数(为 NULL 时使用 uolist_set_order 所设置的比较函数)
+ * @param           线程数(小于等于 0 时使用在线的处理器个数)
+ * @return          
+ *      @arg  0:正常
+ *      @arg  PAR_ERROR:参数错误
+ *      @arg  FUN_ERROR:函数错误
+ */
+int uolist_parallel_sort(uolist_t *uo, order_t my_order, int nthreads);
+
+
+/**
+ * @brief           将源链表的全部节点接到目标链表尾部
+ * @details         只重新连接节点, 为 O(1)(UOLIST_POOL 模式需遍历源链表的内存池大块).
+ *                  两个链表的数据大小及存储模式须相同(UOLIST_SKIPLIST 除外),
+ *                  源链表中的数据此后由目标链表的销毁函数释放, 源链表成为空链表.
+ *                  UOLIST_POOL 模式下源链表的内存池一并移交给目标链表.
+ *                  目标链表退出有序模式
+ * @param           目标链表头信息结构体的指针
+ * @param           源链表头信息结构体的指针
+ * @return          
+ *      @arg  0:正常
+ *      @arg  PAR_ERROR:参数错误
+ */
+int uolist_concat(uolist_t *dst, uolist_t *src);
+
+
+/**
+ * @brief           从索引位置将链表拆分为两个链表
+ * @details         索引 index 及之后的节点移入新链表, 原链表保留前 index 个节点.
+ *                  新链表的数据大小、销毁函数、存储模式及有序模式与原链表相同.
+ *                  定位拆分位置为 O(index)(UOLIST_SKIPLIST 模式为 O(log n)),
+ *                  节点只重新连接; UOLIST_POOL 模式下节点不能离开所属的内存池,
+ *                  后半部分的数据拷贝到新链表中, 为 O(n).
+ *                  新链表使用完毕后须调用 uolist_destroy 及 head_destroy
+ * @param           头信息结构体的指针
+ * @param           索引值(0 <= index <= 节点个数)
+ * @return          指向新链表头信息结构体的指针
+ *      @arg  PAR_ERROR:参数错误
+ *      @arg  FUN_ERROR:函数错误(链表不变)
+ */
+uolist_t *uolist_split_at(uolist_t *uo, int index);
+
+
+/**
+ * @brief           对链表加共享锁
+ * @details         持有期间只能调用游标的只读函数及 uolist_borrow_by_*, 不能调用
+ *                  uolist_borrow_mut_by_*、原地构造、修改数据的游标函数及其他加锁的链表函数.
+ *                  非 UOLIST_CONCURRENT 模式下直接返回
+ * @param           头信息结构体的指针
+ * @return          
+ *      @arg  0:正常
+ *      @arg  PAR_ERROR:参数错误
+ */
+int uolist_lock_read(uolist_t *uo);
+
+
+/**
+ * @brief           对链表加独占锁
+ * @details         持有期间可调用全部游标、借用及原地构造函数, 不能调用其他加锁的链表函数.
+ *                  非 UOLIST_CONCURRENT 模式下直接返回
+ * @param           头信息结构体的指针
+ * @return          
+ *      @arg  0:正常
+ *      @arg  PAR_ERROR:参数错误
+ */
+int uolist_lock_write(uolist_t *uo);
+
+
+/**
+ * @brief           释放 uolist_lock_read / uolist_lock_write 所加的锁
+ * @details         释放独占锁前重建失效的跳表及哈希索引, 之后的读操作可同时进行
+ * @param           头信息结构体的指针
+ * @return          
+ *      @arg  0:正常
+ *      @arg  PAR_ERROR:参数错误
+ */
+int uolist_unlock(uolist_t *uo);
+
+
 
 
 #endif /* __UNI_ONEWAY_LINKEDLIST_H__ */
@@ -0,0 +1,386 @@
+/**
+ * @file                uolist_epoch.c
+ * @brief               无锁链表的纪元(epoch)回收
+ * @details             全局纪元只在所有处于临界区的线程都已进入当前纪元时推进.
+ *                      节点在纪元 e 摘除, 纪元推进到 e + 2 时, 可能读取到该节点的
+ *                      线程都已离开临界区, 节点可以释放.
+ *                      读者进入/离开临界区只写自己的线程记录, 删除不会阻塞读者.
+ *                      线程退出时(线程私有数据的析构函数)将其记录置为空闲, 空闲记录中的
+ *                      节点由推进纪元的线程代为释放, 记录本身由之后加入的线程接管,
+ *                      记录个数不超过同时访问链表的线程数
+ * @author              BHR
+ * @version             v1.2
+ * @date                2026-10-16
+ * @copyright           MIT
+ */
+
+#include "uolist_epoch.h"
+
+// 线程记录缓存: 最近一次访问的链表编号及线程记录
+static __thread unsigned long __cache_id = 0;
+static __thread epoch_rec_t *__cache_rec = NULL;
+
+// 纪元回收编号分配(从 1 开始)
+static unsigned long __next_id = 0;
+
+// 线程私有数据: 当前线程在各纪元回收中的记录(由 tnext 串联), 线程退出时释放
+static pthread_key_t __thread_key;
+static pthread_once_t __key_once = PTHREAD_ONCE_INIT;
+
+
+/**
+ * @brief           释放一组待回收节点
+ * @param           纪元回收结构体指针
+ * @param           待回收链表
+ * @return          无
+ */
+static void __limbo_free(epoch_t *ebr, lfnode_t *p)
+{
+    lfnode_t *save = NULL;
+
+    for (; NULL != p; p = save)
+    {
+        save = p->retire;
+        if (NULL != ebr->my_destroy)
+        {
+            ebr->my_destroy(p->data);
+        } /* end of if (NULL != ebr->my_destroy) */
+        free(p);
+    } /* end of for (; NULL != p; p = save) */
+}
+
+
+/**
+ * @brief           释放已经安全的待回收节点
+ * @param           纪元回收结构体指针
+ * @param           当前线程的记录
+ * @param           全局纪元
+ * @return          无
+ */
+static void __epoch_collect(epoch_t *ebr, epoch_rec_t *rec, unsigned long global)
+{
+    int i = 0;
+
+    for (i = 0; i < 3; i++)
+    {
+        if (NULL != rec->limbo[i] && rec->limbo_epoch[i] + 2 <= global)
+        {
+            __limbo_free(ebr, rec->limbo[i]);
+            rec->limbo[i] = NULL;
+        } /* end of if (NULL != rec->limbo[i] && rec->limbo_epoch[i] + 2 <= global) */
+    } /* end of for (i = 0; i < 3; i++) */
+    rec->seen = global;
+}
+
+
+/**
+ * @brief           释放记录的一个引用, 引用全部释放后释放记录
+ * @param           线程记录
+ * @return          无
+ */
+static void __epoch_rec_put(epoch_rec_t *rec)
+{
+    if (0 == __atomic_sub_fetch(&rec->refs, 1, __ATOMIC_ACQ_REL))
+    {
+        free(rec);
+    } /* end of if (0 == __atomic_sub_fetch(&rec->refs, 1, __ATOMIC_ACQ_REL)) */
+}
+
+
+/**
+ * @brief           线程退出时将其全部记录置为空闲
+ * @param           当前线程的记录链表
+ * @return          无
+ */
+static void __epoch_thread_exit(void *arg)
+{
+    epoch_rec_t *rec = (epoch_rec_t *)arg;
+    epoch_rec_t *save = NULL;
+
+    for (; NULL != rec; rec = save)
+    {
+        // 置为空闲后记录可能被其他线程接管, 须先取出后继
+        save = rec->tnext;
+        __atomic_store_n(&rec->state, LFREC_IDLE, __ATOMIC_RELEASE);
+        __epoch_rec_put(rec);
+    } /* end of for (; NULL != rec; rec = save) */
+}
+
+
+/**
+ * @brief           创建线程私有数据的键
+ * @return          无
+ */
+static void __epoch_key_create(void)
+{
+    pthread_key_create(&__thread_key, __epoch_thread_exit);
+}
+
+
+/**
+ * @brief           代为释放空闲记录中已经安全的待回收节点
+ * @param           纪元回收结构体指针
+ * @param           全局纪元
+ * @return          无
+ */
+static void __epoch_adopt(epoch_t *ebr, unsigned long global)
+{
+    epoch_rec_t *rec = NULL;
+    int state = 0;
+
+    for (rec = __atomic_load_n(&ebr->recs, __ATOMIC_ACQUIRE); NULL != rec; rec = rec->next)
+    {
+        state = LFREC_IDLE;
+        if (LFREC_IDLE == __atomic_load_n(&rec->state, __ATOMIC_RELAXED)
+            && __atomic_compare_exchange_n(&rec->state, &state, LFREC_BUSY, 0, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED))
+        {
+            __epoch_collect(ebr, rec, global);
+            __atomic_store_n(&rec->state, LFREC_IDLE, __ATOMIC_RELEASE);
+        } /* end of if (LFREC_IDLE == ... && __atomic_compare_exchange_n(&rec->state, ...)) */
+    } /* end of for (rec = ...; NULL != rec; rec = rec->next) */
+}
+
+
+/**
+ * @brief           尝试推进全局纪元
+ * @param           纪元回收结构体指针
+ * @param           当前的全局纪元
+ * @return          无
+ */
+static void __epoch_advance(epoch_t *ebr, unsigned long global)
+{
+    epoch_rec_t *rec = NULL;
+    unsigned long local = 0;
+
+    /* 1.有线程仍处于更早的纪元时不能推进 */
+    for (rec = __atomic_load_n(&ebr->recs, __ATOMIC_ACQUIRE); NULL != rec; rec = rec->next)
+    {
+        local = __atomic_load_n(&rec->local, __ATOMIC_SEQ_CST);
+        if ((local & 1) && (local >> 1) != global)
+        {
+            return;
+        } /* end of if ((local & 1) && (local >> 1) != global) */
+    } /* end of for (rec = ...; NULL != rec; rec = rec->next) */
+
+    /* 2.其他线程已推进时 CAS 失败, 无需重试 */
+    if (__atomic_compare_exchange_n(&ebr->global, &global, global + 1, 0, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED))
+    {
+        /* 3.已退出线程的记录不会再进入临界区, 由推进纪元的线程代为回收 */
+        __epoch_adopt(ebr, global + 1);
+    } /* end of if (__atomic_compare_exchange_n(&ebr->global, &global, global + 1, ...)) */
+}
+
+
+/**
+ * @brief           获取当前线程的记录, 首次访问时创建
+ * @param           纪元回收结构体指针
+ * @return          线程记录, 失败返回 NULL
+ */
+static epoch_rec_t *__epoch_rec(epoch_t *ebr)
+{
+    epoch_rec_t *head = NULL;
+    epoch_rec_t *rec = NULL;
+    epoch_rec_t **pp = NULL;
+    int state = 0;
+
+    /* 1.优先使用缓存 */
+    if (__cache_id == ebr->id)
+    {
+        return __cache_rec;
+    } /* end of if (__cache_id == ebr->id) */
+
+    /* 2.查找本线程已有的记录, 顺带释放所属链表已销毁(只剩本线程引用)的记录 */
+    pthread_once(&__key_once, __epoch_key_create);
+    head = (epoch_rec_t *)pthread_getspecific(__thread_key);
+    for (pp = &head; NULL != *pp && (*pp)->id != ebr->id; )
+    {
+        rec = *pp;
+        if (1 == __atomic_load_n(&rec->refs, __ATOMIC_ACQUIRE))
+        {
+            *pp = rec->tnext;
+            free(rec);
+            continue;
+        } /* end of if (1 == __atomic_load_n(&rec->refs, __ATOMIC_ACQUIRE)) */
+        pp = &rec->tnext;
+    } /* end of for (pp = &head; NULL != *pp && (*pp)->id != ebr->id; ) */
+    rec = *pp;
+
+    /* 3.接管已退出线程的空闲记录(其中的待回收节点一并接管) */
+    if (NULL == rec)
+    {
+        for (rec = __atomic_load_n(&ebr->recs, __ATOMIC_ACQUIRE); NULL != rec; rec = rec->next)
+        {
+            state = LFREC_IDLE;
+            if (__atomic_compare_exchange_n(&rec->state, &state, LFREC_ACTIVE, 0, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED))
+            {
+                __atomic_add_fetch(&rec->refs, 1, __ATOMIC_RELAXED);
+                break;
+            } /* end of if (__atomic_compare_exchange_n(&rec->state, &state, LFREC_ACTIVE, ...)) */
+        } /* end of for (rec = ...; NULL != rec; rec = rec->next) */
+    } /* end of if (NULL == rec) */
+
+    /* 4.创建新记录并加入记录链表头部(链表及本线程各持有一个引用) */
+    if (NULL == rec)
+    {
+        rec = (epoch_rec_t *)calloc(1, sizeof(epoch_rec_t));
+        if (NULL == rec)
+        {
+        #ifdef DEBUG
+            printf("__epoch_rec: calloc error\n");
+        #elif defined FILE_DEBUG
+            
+        #endif
+            pthread_setspecific(__thread_key, head);
+            return NULL;
+        } /* end of if (NULL == rec) */
+        rec->state = LFREC_ACTIVE;
+        rec->refs = 2;
+        rec->id = ebr->id;
+        rec->next = __atomic_load_n(&ebr->recs, __ATOMIC_RELAXED);
+        while (!__atomic_compare_exchange_n(&ebr->recs, &rec->next, rec, 1, __ATOMIC_RELEASE, __ATOMIC_RELAXED))
+        {
+            ;
+        } /* end of while (!__atomic_compare_exchange_n(&ebr->recs, &rec->next, rec, ...)) */
+    } /* end of if (NULL == rec) */
+
+    /* 5.新获得的记录加入本线程的记录链表 */
+    if (rec != *pp)
+    {
+        rec->tnext = head;
+        head = rec;
+    } /* end of if (rec != *pp) */
+    pthread_setspecific(__thread_key, head);
+
+    __cache_id = ebr->id;
+    __cache_rec = rec;
+
+    return rec;
+}
+
+
+
+/**
+ * @brief           初始化纪元回收
+ * @param           纪元回收结构体的指针
+ * @param           释放节点时调用的销毁函数(可为 NULL)
+ * @return          0
+ */
+int epoch_init(epoch_t *ebr, op_t my_destroy)
+{
+    ebr->global = 0;
+    ebr->id = __atomic_add_fetch(&__next_id, 1, __ATOMIC_RELAXED);
+    ebr->recs = NULL;
+    ebr->my_destroy = my_destroy;
+
+    return 0;
+}
+
+
+/**
+ * @brief           释放全部待回收节点及线程记录
+ * @details         须在其他线程不再访问链表后调用; 所属线程仍在运行的记录由该线程稍后释放
+ * @param           纪元回收结构体的指针
+ * @return          0
+ */
+int epoch_release(epoch_t *ebr)
+{
+    epoch_rec_t *rec = NULL;
+    epoch_rec_t *save = NULL;
+    int i = 0;
+
+    for (rec = ebr->recs; NULL != rec; rec = save)
+    {
+        save = rec->next;
+        for (i = 0; i < 3; i++)
+        {
+            __limbo_free(ebr, rec->limbo[i]);
+            rec->limbo[i] = NULL;
+        } /* end of for (i = 0; i < 3; i++) */
+        // 所属线程仍在运行时由该线程释放记录
+        __epoch_rec_put(rec);
+    } /* end of for (rec = ebr->recs; NULL != rec; rec = save) */
+    ebr->recs = NULL;
+
+    return 0;
+}
+
+
+/**
+ * @brief           当前线程进入临界区
+ * @details         临界区中读取到的节点在离开临界区之前不会被释放
+ * @param           纪元回收结构体的指针
+ * @return          当前线程的记录, 失败返回 NULL
+ */
+epoch_rec_t *epoch_enter(epoch_t *ebr)
+{
+    epoch_rec_t *rec = NULL;
+    unsigned long global = 0;
+
+    rec = __epoch_rec(ebr);
+    if (NULL == rec)
+    {
+        return NULL;
+    } /* end of if (NULL == rec) */
+
+    /* 1.公布进入的纪元, 之后才能读取链表 */
+    global = __atomic_load_n(&ebr->global, __ATOMIC_SEQ_CST);
+    __atomic_store_n(&rec->local, (global << 1) | 1, __ATOMIC_SEQ_CST);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+
+    /* 2.纪元推进后顺带回收 */
+    if (global != rec->seen)
+    {
+        __epoch_collect(ebr, rec, global);
+    } /* end of if (global != rec->seen) */
+
+    return rec;
+}
+
+
+/**
+ * @brief           当前线程离开临界区
+ * @param           当前线程的记录
+ * @return          0
+ */
+int epoch_exit(epoch_rec_t *rec)
+{
+    __atomic_store_n(&rec->local, 0, __ATOMIC_RELEASE);
+
+    return 0;
+}
+
+
+/**
+ * @brief           将摘除的节点放入当前线程的待回收链表
+ * @details         须在临界区中调用, 节点在两次纪元推进之后释放
+ * @param           纪元回收结构体的指针
+ * @param           当前线程的记录
+ * @param           已摘除的节点
+ * @return          0
+ */
+int epoch_retire(epoch_t *ebr, epoch_rec_t *rec, lfnode_t *p)
+{
+    unsigned long global = __atomic_load_n(&ebr->global, __ATOMIC_SEQ_CST);
+    int i = global % 3;
+
+    /* 1.同组中更早摘除的节点(至少早 3 个纪元)已经安全 */
+    if (rec->limbo_epoch[i] != global)
+    {
+        __limbo_free(ebr, rec->limbo[i]);
+        rec->limbo[i] = NULL;
+        rec->limbo_epoch[i] = global;
+    } /* end of if (rec->limbo_epoch[i] != global) */
+
+    /* 2.加入待回收链表 */
+    p->retire = rec->limbo[i];
+    rec->limbo[i] = p;
+
+    /* 3.摘除一定数量的节点后尝试推进纪元 */
+    if (++rec->retired >= EPOCH_RETIRE_BATCH)
+    {
+        rec->retired = 0;
+        __epoch_advance(ebr, global);
+    } /* end of if (++rec->retired >= EPOCH_RETIRE_BATCH) */
+
+    return 0;
+}
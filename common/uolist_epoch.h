@@ -0,0 +1,66 @@
+/**
+ * @file                uolist_epoch.h
+ * @brief               无锁链表的纪元(epoch)回收
+ * @details             供 uolist_lockfree.c 及 uolist_queue.c 调用, 调用者负责参数检查
+ * @author              BHR
+ * @version             v1.2
+ * @date                2026-10-16
+ * @copyright           MIT
+ */
+
+#ifndef __UOLIST_EPOCH_H__
+#define __UOLIST_EPOCH_H__
+
+#include "uolist_lockfree.h"
+
+
+/**
+ * @brief           初始化纪元回收
+ * @param           纪元回收结构体的指针
+ * @param           释放节点时调用的销毁函数(可为 NULL)
+ * @return          0
+ */
+int epoch_init(epoch_t *ebr, op_t my_destroy);
+
+
+/**
+ * @brief           释放全部待回收节点及线程记录
+ * @details         须在其他线程不再访问链表后调用; 所属线程仍在运行的记录由该线程稍后释放
+ * @param           纪元回收结构体的指针
+ * @return          0
+ */
+int epoch_release(epoch_t *ebr);
+
+
+/**
+ * @brief           当前线程进入临界区
+ * @details         临界区中读取到的节点在离开临界区之前不会被释放
+ * @param           纪元回收结构体的指针
+ * @return          当前线程的记录, 失败返回 NULL
+ */
+epoch_rec_t *epoch_enter(epoch_t *ebr);
+
+
+/**
+ * @brief           当前线程离开临界区
+ * @param           当前线程的记录
+ * @return          0
+ */
+int epoch_exit(epoch_rec_t *rec);
+
+
+/**
+ * @brief           将摘除的节点放入当前线程的待回收链表
+ * @details         须在临界区中调用, 节点在两次纪元推进之后释放
+ * @param           纪元回收结构体的指针
+ * @param           当前线程的记录
+ * @param           已摘除的节点
+ * @return          0
+ */
+int epoch_retire(epoch_t *ebr, epoch_rec_t *rec, lfnode_t *p);
+
+
+
+
+#endif /* __UOLIST_EPOCH_H__ */
+
@@ -0,0 +1,435 @@
+/**
+ * @file                uolist_hash.c
+ * @brief               万能型单向链表的哈希索引
+ * @details             表项只记录链表节点及其哈希值, 链表顺序仍由链表本身维护.
+ *                      桶中只有一个匹配节点时直接返回; 有多个匹配节点(关键字重复)
+ *                      时无法确定链表中的先后顺序, 由调用者遍历链表
+ * @author              BHR
+ * @version             v1.2
+ * @date                2026-10-16
+ * @copyright           MIT
+ */
+
+#include "uolist_hash.h"
+
+// 哈希索引的初始桶数
+#define HINDEX_MIN_BUCKET 64
+
+/**
+ * @brief           打散自定义哈希函数的结果, 避免低位分布不均
+ * @param           链表头信息结构体指针
+ * @param           数据或关键字
+ * @return          哈希值
+ */
+static unsigned int __hash(uolist_t *uo, void *data)
+{
+    unsigned int h = uo->hidx->my_hash(data);
+
+    h ^= h >> 16;
+    h *= 0x45d9f3bu;
+    h ^= h >> 16;
+
+    return h;
+}
+
+
+/**
+ * @brief           调整桶数, 表项按保存的哈希值重新分配
+ * @param           链表头信息结构体指针
+ * @param           新的桶数(2 的幂)
+ * @return
+ *      @arg  0:正常
+ *      @arg  FUN_ERROR:函数错误(索引不变)
+ */
+static int __hindex_resize(uolist_t *uo, int nbucket)
+{
+    hindex_t *h = uo->hidx;
+    hentry_t **buckets = NULL;
+    hentry_t *e = NULL;
+    hentry_t *save = NULL;
+    int i = 0;
+
+    buckets = (hentry_t **)calloc(nbucket, sizeof(hentry_t *));
+    if (NULL == buckets)
+    {
+    #ifdef DEBUG
+        printf("__hindex_resize: calloc error\n");
+    #elif defined FILE_DEBUG
+
+    #endif
+        return FUN_ERROR;
+    } /* end of if (NULL == buckets) */
+
+    for (i = 0; i < h->nbucket; i++)
+    {
+        for (e = h->buckets[i]; NULL != e; e = save)
+        {
+            save = e->next;
+            e->next = buckets[e->hash & (nbucket - 1)];
+            buckets[e->hash & (nbucket - 1)] = e;
+        } /* end of for (e = h->buckets[i]; NULL != e; e = save) */
+    } /* end of for (i = 0; i < h->nbucket; i++) */
+
+    free(h->buckets);
+    h->buckets = buckets;
+    h->nbucket = nbucket;
+
+    return 0;
+}
+
+
+/**
+ * @brief           添加一个表项
+ * @param           链表头信息结构体指针
+ * @param           链表节点
+ * @return
+ *      @arg  0:正常
+ *      @arg  FUN_ERROR:函数错误
+ */
+static int __hindex_add(uolist_t *uo, node_t *p)
+{
+    hindex_t *h = uo->hidx;
+    hentry_t *e = NULL;
+
+    // 装载因子超过 1 时桶数翻倍, 扩容失败不影响正确性
+    if (h->count >= h->nbucket)
+    {
+        __hindex_resize(uo, h->nbucket * 2);
+    } /* end of if (h->count >= h->nbucket) */
+
+    e = (hentry_t *)malloc(sizeof(hentry_t));
+    if (NULL == e)
+    {
+    #ifdef DEBUG
+        printf("__hindex_add: malloc error\n");
+    #elif defined FILE_DEBUG
+
+    #endif
+        return FUN_ERROR;
+    } /* end of if (NULL == e) */
+
+    e->node = p;
+    e->hash = __hash(uo, p->data);
+    e->next = h->buckets[e->hash & (h->nbucket - 1)];
+    h->buckets[e->hash & (h->nbucket - 1)] = e;
+    h->count++;
+
+    return 0;
+}
+
+
+/**
+ * @brief           索引失效时根据链表重建索引
+ * @param           链表头信息结构体指针
+ * @return
+ *      @arg  0:正常
+ *      @arg  FUN_ERROR:函数错误(索引仍为失效状态)
+ */
+static int __hindex_sync(uolist_t *uo)
+{
+    hindex_t *h = uo->hidx;
+    node_t *p = NULL;
+    int nbucket = HINDEX_MIN_BUCKET;
+
+    if (!h->dirty)
+    {
+        return 0;
+    } /* end of if (!h->dirty) */
+
+    /* 1.释放原有表项, 桶数按节点个数一次调整到位 */
+    hindex_clear(uo);
+    while (nbucket < uo->count)
+    {
+        nbucket *= 2;
+    } /* end of while (nbucket < uo->count) */
+    if (nbucket != h->nbucket && 0 != __hindex_resize(uo, nbucket))
+    {
+        return FUN_ERROR;
+    } /* end of if (nbucket != h->nbucket && 0 != __hindex_resize(uo, nbucket)) */
+
+    /* 2.依次添加表项 */
+    for (p = uo->fstnode_p; NULL != p; p = p->next)
+    {
+        if (0 != __hindex_add(uo, p))
+        {
+            hindex_clear(uo);
+            return FUN_ERROR;
+        } /* end of if (0 != __hindex_add(uo, p)) */
+    } /* end of for (p = uo->fstnode_p; NULL != p; p = p->next) */
+
+    h->dirty = 0;
+
+    return 0;
+}
+
+
+
+/**
+ * @brief           创建哈希索引(索引处于失效状态, 首次查找时建立)
+ * @param           头信息结构体的指针
+ * @param           自定义哈希函数
+ * @param           与哈希函数配套的比较函数
+ * @return
+ *      @arg  0:正常
+ *      @arg  FUN_ERROR:函数错误
+ */
+int hindex_attach(uolist_t *uo, hash_t my_hash, cmp_t op_cmp)
+{
+    hindex_t *h = NULL;
+
+    h = (hindex_t *)calloc(1, sizeof(hindex_t));
+    if (NULL == h)
+    {
+    #ifdef DEBUG
+        printf("hindex_attach: calloc error\n");
+    #elif defined FILE_DEBUG
+
+    #endif
+        goto ERR1;
+    } /* end of if (NULL == h) */
+
+    h->buckets = (hentry_t **)calloc(HINDEX_MIN_BUCKET, sizeof(hentry_t *));
+    if (NULL == h->buckets)
+    {
+    #ifdef DEBUG
+        printf("hindex_attach: calloc error\n");
+    #elif defined FILE_DEBUG
+
+    #endif
+        goto ERR2;
+    } /* end of if (NULL == h->buckets) */
+
+    h->nbucket = HINDEX_MIN_BUCKET;
+    h->count = 0;
+    h->dirty = 1;
+    h->my_hash = my_hash;
+    h->op_cmp = op_cmp;
+
+    /* 替换原有索引 */
+    hindex_release(uo);
+    uo->hidx = h;
+
+    return 0;
+
+ERR2:
+    free(h);
+ERR1:
+    return FUN_ERROR;
+}
+
+
+/**
+ * @brief           释放哈希索引
+ * @param           头信息结构体的指针
+ * @return          0
+ */
+int hindex_release(uolist_t *uo)
+{
+    if (NULL != uo->hidx)
+    {
+        hindex_clear(uo);
+        free(uo->hidx->buckets);
+        free(uo->hidx);
+        uo->hidx = NULL;
+    } /* end of if (NULL != uo->hidx) */
+
+    return 0;
+}
+
+
+/**
+ * @brief           释放全部表项, 并使索引失效
+ * @param           头信息结构体的指针
+ * @return          0
+ */
+int hindex_clear(uolist_t *uo)
+{
+    hindex_t *h = uo->hidx;
+    hentry_t *e = NULL;
+    hentry_t *save = NULL;
+    int i = 0;
+
+    if (NULL == h)
+    {
+        return 0;
+    } /* end of if (NULL == h) */
+
+    for (i = 0; i < h->nbucket && h->count > 0; i++)
+    {
+        for (e = h->buckets[i]; NULL != e; e = save)
+        {
+            save = e->next;
+            free(e);
+            h->count--;
+        } /* end of for (e = h->buckets[i]; NULL != e; e = save) */
+        h->buckets[i] = NULL;
+    } /* end of for (i = 0; i < h->nbucket && h->count > 0; i++) */
+    h->dirty = 1;
+
+    return 0;
+}
+
+
+/**
+ * @brief           使索引失效(数据可能已被改写)
+ * @param           头信息结构体的指针
+ * @return          0
+ */
+int hindex_invalidate(uolist_t *uo)
+{
+    if (NULL != uo->hidx)
+    {
+        __atomic_store_n(&uo->hidx->dirty, 1, __ATOMIC_RELAXED);
+    } /* end of if (NULL != uo->hidx) */
+
+    return 0;
+}
+
+
+/**
+ * @brief           索引失效时根据链表重建索引
+ * @param           头信息结构体的指针
+ * @return
+ *      @arg  0:正常(或未附加索引)
+ *      @arg  FUN_ERROR:函数错误(索引仍为失效状态)
+ */
+int hindex_sync(uolist_t *uo)
+{
+    if (NULL == uo->hidx)
+    {
+        return 0;
+    } /* end of if (NULL == uo->hidx) */
+
+    return __hindex_sync(uo);
+}
+
+
+/**
+ * @brief           为新连接的链表节点添加表项
+ * @param           头信息结构体的指针
+ * @param           链表节点(数据已写入)
+ * @return          0
+ */
+int hindex_insert(uolist_t *uo, node_t *p)
+{
+    // 索引已失效时等待重建
+    if (NULL == uo->hidx || uo->hidx->dirty)
+    {
+        return 0;
+    } /* end of if (NULL == uo->hidx || uo->hidx->dirty) */
+
+    if (0 != __hindex_add(uo, p))
+    {
+        uo->hidx->dirty = 1;
+    } /* end of if (0 != __hindex_add(uo, p)) */
+
+    return 0;
+}
+
+
+/**
+ * @brief           删除链表节点对应的表项(须在改写或释放数据之前调用)
+ * @param           头信息结构体的指针
+ * @param           链表节点
+ * @return          0
+ */
+int hindex_remove(uolist_t *uo, node_t *p)
+{
+    hindex_t *h = uo->hidx;
+    hentry_t **pe = NULL;
+    hentry_t *e = NULL;
+
+    if (NULL == h || h->dirty)
+    {
+        return 0;
+    } /* end of if (NULL == h || h->dirty) */
+
+    for (pe = &h->buckets[__hash(uo, p->data) & (h->nbucket - 1)]; NULL != *pe; pe = &(*pe)->next)
+    {
+        if ((*pe)->node == p)
+        {
+            e = *pe;
+            *pe = e->next;
+            free(e);
+            h->count--;
+            return 0;
+        } /* end of if ((*pe)->node == p) */
+    } /* end of for (pe = ...; NULL != *pe; pe = &(*pe)->next) */
+
+    // 找不到表项说明数据已被改写而未标记失效, 重建以保证正确
+    h->dirty = 1;
+
+    return 0;
+}
+
+
+/**
+ * @brief           通过哈希索引查找第一个匹配的节点
+ * @param           头信息结构体的指针
+ * @param           关键字
+ * @param           自定义比较函数
+ * @param           保存匹配节点的指针(无匹配时为 NULL)
+ * @param           保存匹配节点前驱的指针, 可为 NULL
+ * @param           保存匹配节点索引的指针, 可为 NULL
+ * @return
+ *      @arg  0:查找完成
+ *      @arg  FUN_ERROR:索引不可用, 调用者需遍历链表
+ */
+int hindex_find(uolist_t *uo, void *key, cmp_t op_cmp, node_t **node, node_t **prev, int *index)
+{
+    hentry_t *e = NULL;
+    node_t *match = NULL;
+    node_t *p = NULL;
+    node_t *q = NULL;
+    unsigned int hash = 0;
+    int i = 0;
+
+    /* 1.检查索引是否可用 */
+    if (NULL == uo->hidx || op_cmp != uo->hidx->op_cmp)
+    {
+        return FUN_ERROR;
+    } /* end of if (NULL == uo->hidx || op_cmp != uo->hidx->op_cmp) */
+
+    /* 2.索引失效时重建; 并发模式下只有持有独占锁时才能重建, 否则由调用者遍历链表 */
+    if (__atomic_load_n(&uo->hidx->dirty, __ATOMIC_RELAXED))
+    {
+        if ((NULL != uo->lock && !uo->wrheld) || 0 != __hindex_sync(uo))
+        {
+            return FUN_ERROR;
+        } /* end of if ((NULL != uo->lock && !uo->wrheld) || 0 != __hindex_sync(uo)) */
+    } /* end of if (__atomic_load_n(&uo->hidx->dirty, __ATOMIC_RELAXED)) */
+
+    /* 3.在桶中查找匹配节点 */
+    hash = __hash(uo, key);
+    for (e = uo->hidx->buckets[hash & (uo->hidx->nbucket - 1)]; NULL != e; e = e->next)
+    {
+        if (e->hash == hash && MATCH_SUCCESS == op_cmp(e->node->data, key))
+        {
+            if (NULL != match)
+            {
+                return FUN_ERROR;
+            } /* end of if (NULL != match) */
+            match = e->node;
+        } /* end of if (e->hash == hash && MATCH_SUCCESS == op_cmp(e->node->data, key)) */
+    } /* end of for (e = ...; NULL != e; e = e->next) */
+    *node = match;
+
+    /* 4.需要前驱或索引时沿链表比较节点地址 */
+    if (NULL != match && (NULL != prev || NULL != index))
+    {
+        for (p = uo->fstnode_p, q = NULL, i = 0; p != match; q = p, p = p->next, i++)
+        {
+            ;
+        } /* end of for (p = uo->fstnode_p, q = NULL, i = 0; p != match; q = p, p = p->next, i++) */
+        if (NULL != prev)
+        {
+            *prev = q;
+        } /* end of if (NULL != prev) */
+        if (NULL != index)
+        {
+            *index = i;
+        } /* end of if (NULL != index) */
+    } /* end of if (NULL != match && (NULL != prev || NULL != index)) */
+
+    return 0;
+}
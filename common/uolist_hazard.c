@@ -0,0 +1,433 @@
+/**
+ * @file                uolist_hazard.c
+ * @brief               无锁链表的风险指针(hazard pointer)回收
+ * @details             线程访问节点前先将其地址写入自己的风险指针, 再确认节点仍可从链表
+ *                      访问. 摘除的节点先放入摘除线程的待回收链表, 数量达到阈值时
+ *                      收集全部风险指针, 只释放没有被任何风险指针指向的节点.
+ *                      阈值不小于全部风险指针个数的 2 倍, 每次扫描至少释放一半.
+ *                      线程退出时清除其风险指针并将记录置为空闲, 下一次扫描的线程
+ *                      接管其待回收链表, 记录由之后加入的线程重新使用
+ * @author              BHR
+ * @version             v1.2
+ * @date                2026-10-16
+ * @copyright           MIT
+ */
+
+#include "uolist_hazard.h"
+
+// 线程记录缓存: 最近一次访问的链表编号及线程记录
+static __thread unsigned long __cache_id = 0;
+static __thread hazard_rec_t *__cache_rec = NULL;
+
+// 风险指针回收编号分配(从 1 开始)
+static unsigned long __next_id = 0;
+
+// 线程私有数据: 当前线程在各风险指针回收中的记录(由 tnext 串联), 线程退出时释放
+static pthread_key_t __thread_key;
+static pthread_once_t __key_once = PTHREAD_ONCE_INIT;
+
+
+/**
+ * @brief           释放节点
+ * @param           链表头信息结构体指针
+ * @param           节点
+ * @return          无
+ */
+static void __hazard_free(lflist_t *lf, lfnode_t *p)
+{
+    if (NULL != lf->my_destroy)
+    {
+        lf->my_destroy(p->data);
+    } /* end of if (NULL != lf->my_destroy) */
+    free(p);
+}
+
+
+/**
+ * @brief           指针比较函数(供 qsort / bsearch 使用)
+ * @param           指针的地址
+ * @param           指针的地址
+ * @return          小于/等于/大于时返回 -1/0/1
+ */
+static int __ptr_compare(const void *a, const void *b)
+{
+    uintptr_t x = (uintptr_t)*(lfnode_t * const *)a;
+    uintptr_t y = (uintptr_t)*(lfnode_t * const *)b;
+
+    return (x > y) - (x < y);
+}
+
+
+/**
+ * @brief           释放记录的一个引用, 引用全部释放后释放记录
+ * @param           线程记录
+ * @return          无
+ */
+static void __hazard_rec_put(hazard_rec_t *rec)
+{
+    if (0 == __atomic_sub_fetch(&rec->refs, 1, __ATOMIC_ACQ_REL))
+    {
+        free(rec);
+    } /* end of if (0 == __atomic_sub_fetch(&rec->refs, 1, __ATOMIC_ACQ_REL)) */
+}
+
+
+/**
+ * @brief           线程退出时清除其风险指针并将全部记录置为空闲
+ * @param           当前线程的记录链表
+ * @return          无
+ */
+static void __hazard_thread_exit(void *arg)
+{
+    hazard_rec_t *rec = (hazard_rec_t *)arg;
+    hazard_rec_t *save = NULL;
+
+    for (; NULL != rec; rec = save)
+    {
+        save = rec->tnext;
+        hazard_exit(rec);
+        __atomic_store_n(&rec->state, LFREC_IDLE, __ATOMIC_RELEASE);
+        __hazard_rec_put(rec);
+    } /* end of for (; NULL != rec; rec = save) */
+}
+
+
+/**
+ * @brief           创建线程私有数据的键
+ * @return          无
+ */
+static void __hazard_key_create(void)
+{
+    pthread_key_create(&__thread_key, __hazard_thread_exit);
+}
+
+
+/**
+ * @brief           接管空闲记录的待回收链表
+ * @param           链表头信息结构体指针
+ * @param           当前线程的记录
+ * @return          无
+ */
+static void __hazard_adopt(lflist_t *lf, hazard_rec_t *rec)
+{
+    hazard_rec_t *r = NULL;
+    lfnode_t *p = NULL;
+    int state = 0;
+
+    for (r = __atomic_load_n(&lf->hzd.recs, __ATOMIC_ACQUIRE); NULL != r; r = r->next)
+    {
+        state = LFREC_IDLE;
+        if (LFREC_IDLE != __atomic_load_n(&r->state, __ATOMIC_RELAXED)
+            || !__atomic_compare_exchange_n(&r->state, &state, LFREC_BUSY, 0, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED))
+        {
+            continue;
+        } /* end of if (LFREC_IDLE != ... || !__atomic_compare_exchange_n(&r->state, ...)) */
+
+        if (NULL != r->retired)
+        {
+            for (p = r->retired; NULL != p->retire; p = p->retire)
+            {
+                ;
+            } /* end of for (p = r->retired; NULL != p->retire; p = p->retire) */
+            p->retire = rec->retired;
+            rec->retired = r->retired;
+            rec->nretired += r->nretired;
+            r->retired = NULL;
+            r->nretired = 0;
+        } /* end of if (NULL != r->retired) */
+        __atomic_store_n(&r->state, LFREC_IDLE, __ATOMIC_RELEASE);
+    } /* end of for (r = ...; NULL != r; r = r->next) */
+}
+
+
+/**
+ * @brief           扫描全部风险指针, 释放未被保护的待回收节点
+ * @param           链表头信息结构体指针
+ * @param           当前线程的记录
+ * @return          无
+ */
+static void __hazard_scan(lflist_t *lf, hazard_rec_t *rec)
+{
+    hazard_rec_t *r = NULL;
+    lfnode_t **plist = NULL;
+    lfnode_t *p = NULL;
+    lfnode_t *save = NULL;
+    lfnode_t *keep = NULL;
+    hazard_rec_t *recs = NULL;
+    int cap = 0;
+    int n = 0;
+    int i = 0;
+
+    __hazard_adopt(lf, rec);
+
+    /*
+     * 1.收集全部非空风险指针(扫描期间新加入的记录只会保护此后读取到的节点).
+     *   记录个数在记录入链之前增加, 先读取链表头再读取个数, 个数不小于可遍历到的记录数
+     */
+    recs = __atomic_load_n(&lf->hzd.recs, __ATOMIC_ACQUIRE);
+    cap = __atomic_load_n(&lf->hzd.nrec, __ATOMIC_ACQUIRE) * HAZARD_PER_THREAD;
+    plist = (lfnode_t **)malloc(sizeof(lfnode_t *) * cap);
+    if (NULL == plist)
+    {
+    #ifdef DEBUG
+        printf("__hazard_scan: malloc error\n");
+    #elif defined FILE_DEBUG
+        
+    #endif
+        return;
+    } /* end of if (NULL == plist) */
+
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    for (r = recs; NULL != r; r = r->next)
+    {
+        for (i = 0; i < HAZARD_PER_THREAD && n < cap; i++)
+        {
+            p = __atomic_load_n(&r->hp[i], __ATOMIC_SEQ_CST);
+            if (NULL != p)
+            {
+                plist[n++] = p;
+            } /* end of if (NULL != p) */
+        } /* end of for (i = 0; i < HAZARD_PER_THREAD && n < cap; i++) */
+    } /* end of for (r = recs; NULL != r; r = r->next) */
+    qsort(plist, n, sizeof(lfnode_t *), __ptr_compare);
+
+    /* 2.释放未被保护的节点, 其余留待下次扫描 */
+    for (p = rec->retired, rec->nretired = 0; NULL != p; p = save)
+    {
+        save = p->retire;
+        if (NULL != bsearch(&p, plist, n, sizeof(lfnode_t *), __ptr_compare))
+        {
+            p->retire = keep;
+            keep = p;
+            rec->nretired++;
+        }
+        else
+        {
+            __hazard_free(lf, p);
+        }
+    } /* end of for (p = rec->retired, rec->nretired = 0; NULL != p; p = save) */
+    rec->retired = keep;
+
+    free(plist);
+}
+
+
+/**
+ * @brief           获取当前线程的记录, 首次访问时创建
+ * @param           链表头信息结构体指针
+ * @return          线程记录, 失败返回 NULL
+ */
+static hazard_rec_t *__hazard_rec(lflist_t *lf)
+{
+    hazard_rec_t *head = NULL;
+    hazard_rec_t *rec = NULL;
+    hazard_rec_t **pp = NULL;
+    int state = 0;
+
+    /* 1.优先使用缓存 */
+    if (__cache_id == lf->hzd.id)
+    {
+        return __cache_rec;
+    } /* end of if (__cache_id == lf->hzd.id) */
+
+    /* 2.查找本线程已有的记录, 顺带释放所属链表已销毁(只剩本线程引用)的记录 */
+    pthread_once(&__key_once, __hazard_key_create);
+    head = (hazard_rec_t *)pthread_getspecific(__thread_key);
+    for (pp = &head; NULL != *pp && (*pp)->id != lf->hzd.id; )
+    {
+        rec = *pp;
+        if (1 == __atomic_load_n(&rec->refs, __ATOMIC_ACQUIRE))
+        {
+            *pp = rec->tnext;
+            free(rec);
+            continue;
+        } /* end of if (1 == __atomic_load_n(&rec->refs, __ATOMIC_ACQUIRE)) */
+        pp = &rec->tnext;
+    } /* end of for (pp = &head; NULL != *pp && (*pp)->id != lf->hzd.id; ) */
+    rec = *pp;
+
+    /* 3.重新使用已退出线程的空闲记录(风险指针已清除) */
+    if (NULL == rec)
+    {
+        for (rec = __atomic_load_n(&lf->hzd.recs, __ATOMIC_ACQUIRE); NULL != rec; rec = rec->next)
+        {
+            state = LFREC_IDLE;
+            if (__atomic_compare_exchange_n(&rec->state, &state, LFREC_ACTIVE, 0, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED))
+            {
+                __atomic_add_fetch(&rec->refs, 1, __ATOMIC_RELAXED);
+                break;
+            } /* end of if (__atomic_compare_exchange_n(&rec->state, &state, LFREC_ACTIVE, ...)) */
+        } /* end of for (rec = ...; NULL != rec; rec = rec->next) */
+    } /* end of if (NULL == rec) */
+
+    /* 4.创建新记录并加入记录链表头部, 记录个数先于记录可见(链表及本线程各持有一个引用) */
+    if (NULL == rec)
+    {
+        rec = (hazard_rec_t *)calloc(1, sizeof(hazard_rec_t));
+        if (NULL == rec)
+        {
+        #ifdef DEBUG
+            printf("__hazard_rec: calloc error\n");
+        #elif defined FILE_DEBUG
+            
+        #endif
+            pthread_setspecific(__thread_key, head);
+            return NULL;
+        } /* end of if (NULL == rec) */
+        rec->state = LFREC_ACTIVE;
+        rec->refs = 2;
+        rec->id = lf->hzd.id;
+        __atomic_add_fetch(&lf->hzd.nrec, 1, __ATOMIC_RELEASE);
+        rec->next = __atomic_load_n(&lf->hzd.recs, __ATOMIC_RELAXED);
+        while (!__atomic_compare_exchange_n(&lf->hzd.recs, &rec->next, rec, 1, __ATOMIC_RELEASE, __ATOMIC_RELAXED))
+        {
+            ;
+        } /* end of while (!__atomic_compare_exchange_n(&lf->hzd.recs, &rec->next, rec, ...)) */
+    } /* end of if (NULL == rec) */
+
+    /* 5.新获得的记录加入本线程的记录链表 */
+    if (rec != *pp)
+    {
+        rec->tnext = head;
+        head = rec;
+    } /* end of if (rec != *pp) */
+    pthread_setspecific(__thread_key, head);
+
+    __cache_id = lf->hzd.id;
+    __cache_rec = rec;
+
+    return rec;
+}
+
+
+
+/**
+ * @brief           初始化风险指针回收
+ * @param           头信息结构体的指针
+ * @return          0
+ */
+int hazard_init(lflist_t *lf)
+{
+    lf->hzd.recs = NULL;
+    lf->hzd.nrec = 0;
+    lf->hzd.id = __atomic_add_fetch(&__next_id, 1, __ATOMIC_RELAXED);
+
+    return 0;
+}
+
+
+/**
+ * @brief           释放全部待回收节点及线程记录
+ * @details         须在其他线程不再访问链表后调用; 所属线程仍在运行的记录由该线程稍后释放
+ * @param           头信息结构体的指针
+ * @return          0
+ */
+int hazard_release(lflist_t *lf)
+{
+    hazard_rec_t *rec = NULL;
+    hazard_rec_t *save = NULL;
+    lfnode_t *p = NULL;
+    lfnode_t *next = NULL;
+
+    for (rec = lf->hzd.recs; NULL != rec; rec = save)
+    {
+        save = rec->next;
+        for (p = rec->retired; NULL != p; p = next)
+        {
+            next = p->retire;
+            __hazard_free(lf, p);
+        } /* end of for (p = rec->retired; NULL != p; p = next) */
+        rec->retired = NULL;
+        rec->nretired = 0;
+        // 所属线程仍在运行时由该线程释放记录
+        __hazard_rec_put(rec);
+    } /* end of for (rec = lf->hzd.recs; NULL != rec; rec = save) */
+    lf->hzd.recs = NULL;
+    lf->hzd.nrec = 0;
+
+    return 0;
+}
+
+
+/**
+ * @brief           获取当前线程的记录
+ * @param           头信息结构体的指针
+ * @return          当前线程的记录, 失败返回 NULL
+ */
+hazard_rec_t *hazard_enter(lflist_t *lf)
+{
+    return __hazard_rec(lf);
+}
+
+
+/**
+ * @brief           清除当前线程的全部风险指针
+ * @param           当前线程的记录
+ * @return          0
+ */
+int hazard_exit(hazard_rec_t *rec)
+{
+    int i = 0;
+
+    for (i = 0; i < HAZARD_PER_THREAD; i++)
+    {
+        __atomic_store_n(&rec->hp[i], NULL, __ATOMIC_RELEASE);
+    } /* end of for (i = 0; i < HAZARD_PER_THREAD; i++) */
+
+    return 0;
+}
+
+
+/**
+ * @brief           设置风险指针并确认节点仍可从链表访问
+ * @param           当前线程的记录
+ * @param           风险指针序号
+ * @param           要访问的节点
+ * @param           指向该节点的指针域的地址(为 NULL 表示节点已受本线程其他风险指针保护, 不确认)
+ * @return
+ *      @arg  0:节点受保护
+ *      @arg  FUN_ERROR:指针域已改变, 调用者需重新查找
+ */
+int hazard_protect(hazard_rec_t *rec, int slot, lfnode_t *p, lfnode_t **pp)
+{
+    /* 节点已受保护时只需转移到指定的风险指针 */
+    if (NULL == pp)
+    {
+        __atomic_store_n(&rec->hp[slot], p, __ATOMIC_RELEASE);
+        return 0;
+    } /* end of if (NULL == pp) */
+
+    /* 风险指针须先于确认读取对扫描线程可见(两者均为顺序一致操作) */
+    __atomic_store_n(&rec->hp[slot], p, __ATOMIC_SEQ_CST);
+    if (__atomic_load_n(pp, __ATOMIC_SEQ_CST) != p)
+    {
+        return FUN_ERROR;
+    } /* end of if (__atomic_load_n(pp, __ATOMIC_SEQ_CST) != p) */
+
+    return 0;
+}
+
+
+/**
+ * @brief           将摘除的节点放入当前线程的待回收链表
+ * @details         待回收节点数达到阈值时扫描全部风险指针, 释放未被保护的节点
+ * @param           头信息结构体的指针
+ * @param           当前线程的记录
+ * @param           已摘除的节点
+ * @return          0
+ */
+int hazard_retire(lflist_t *lf, hazard_rec_t *rec, lfnode_t *p)
+{
+    int limit = 2 * HAZARD_PER_THREAD * __atomic_load_n(&lf->hzd.nrec, __ATOMIC_RELAXED);
+
+    p->retire = rec->retired;
+    rec->retired = p;
+    rec->nretired++;
+
+    if (rec->nretired >= limit && rec->nretired >= HAZARD_RETIRE_BATCH)
+    {
+        __hazard_scan(lf, rec);
+    } /* end of if (rec->nretired >= limit && rec->nretired >= HAZARD_RETIRE_BATCH) */
+
+    return 0;
+}
@@ -0,0 +1,77 @@
+/**
+ * @file                uolist_hazard.h
+ * @brief               无锁链表的风险指针(hazard pointer)回收
+ * @details             供 uolist_lockfree.c 在 LFLIST_HAZARD 方式下调用, 调用者负责参数检查
+ * @author              BHR
+ * @version             v1.2
+ * @date                2026-10-16
+ * @copyright           MIT
+ */
+
+#ifndef __UOLIST_HAZARD_H__
+#define __UOLIST_HAZARD_H__
+
+#include "uolist_lockfree.h"
+
+
+/**
+ * @brief           初始化风险指针回收
+ * @param           头信息结构体的指针
+ * @return          0
+ */
+int hazard_init(lflist_t *lf);
+
+
+/**
+ * @brief           释放全部待回收节点及线程记录
+ * @details         须在其他线程不再访问链表后调用; 所属线程仍在运行的记录由该线程稍后释放
+ * @param           头信息结构体的指针
+ * @return          0
+ */
+int hazard_release(lflist_t *lf);
+
+
+/**
+ * @brief           获取当前线程的记录
+ * @param           头信息结构体的指针
+ * @return          当前线程的记录, 失败返回 NULL
+ */
+hazard_rec_t *hazard_enter(lflist_t *lf);
+
+
+/**
+ * @brief           清除当前线程的全部风险指针
+ * @param           当前线程的记录
+ * @return          0
+ */
+int hazard_exit(hazard_rec_t *rec);
+
+
+/**
+ * @brief           设置风险指针并确认节点仍可从链表访问
+ * @param           当前线程的记录
+ * @param           风险指针序号
+ * @param           要访问的节点
+ * @param           指向该节点的指针域的地址(为 NULL 表示节点已受本线程其他风险指针保护, 不确认)
+ * @return
+ *      @arg  0:节点受保护
+ *      @arg  FUN_ERROR:指针域已改变, 调用者需重新查找
+ */
+int hazard_protect(hazard_rec_t *rec, int slot, lfnode_t *p, lfnode_t **pp);
+
+
+/**
+ * @brief           将摘除的节点放入当前线程的待回收链表
+ * @details         待回收节点数达到阈值时扫描全部风险指针, 释放未被保护的节点
+ * @param           头信息结构体的指针
+ * @param           当前线程的记录
+ * @param           已摘除的节点
+ * @return          0
+ */
+int hazard_retire(lflist_t *lf, hazard_rec_t *rec, lfnode_t *p);
+
+
+
+
+#endif /* __UOLIST_HAZARD_H__ */
+
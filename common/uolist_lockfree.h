@@ -0,0 +1,227 @@
+/**
+ * @file                uolist_lockfree.h
+ * @brief               无锁有序单向链表(Harris 算法)
+ * @details             节点按三路比较函数升序排列, 插入、按关键字删除及获取
+ *                      均不加锁, 可在任意多个线程中同时调用.
+ *                      删除先在节点指针域最低位做逻辑删除标记, 再用 CAS 摘除;
+ *                      遍历中遇到已标记的节点时顺带摘除.
+ *                      数据写入后不再修改. 摘除的节点按创建时选择的方式回收:
+ *                      纪元(epoch)回收时, 所有线程都离开节点摘除时所在的纪元后才释放节点;
+ *                      风险指针(hazard pointer)回收时, 没有线程的风险指针指向节点才释放
+ * @author              BHR
+ * @version             v1.2
+ * @date                2026-10-16
+ * @copyright           MIT
+ */
+
+#ifndef __UOLIST_LOCKFREE_H__
+#define __UOLIST_LOCKFREE_H__
+
+#include <stdint.h>
+#include "uni_oneway_linkedlist.h"
+
+
+/**
+ * @brief 无锁链表节点定义
+ * @details 数据域与指针域同 node_t, 指针域最低位为逻辑删除标记;
+ *          节点摘除后由 retire 串联在摘除线程的待回收链表中
+ */
+typedef struct _lfnode_t
+{
+    void *data;                     // 数据域(指向内联数据域)
+    struct _lfnode_t *next;         // 指针域(最低位为删除标记)
+    struct _lfnode_t *retire;       // 待回收链表中的下一个节点
+    char payload[];                 // 内联数据域
+}lfnode_t;
+
+
+/**
+ * @brief 纪元回收的线程记录定义
+ * @details 每个访问过链表的线程一条记录, 待回收链表只由所属线程访问,
+ *          按摘除时的全局纪元分为 3 组.
+ *          线程退出后记录转为空闲, 由推进纪元的线程代为回收其中的节点, 或由新线程接管;
+ *          链表及所属线程各持有一个引用, 两者都释放后记录才释放
+ */
+typedef struct _epoch_rec_t
+{
+    unsigned long local;            // (进入临界区时的全局纪元 << 1) | 是否在临界区中
+    int state;                      // 记录状态(LFREC_ACTIVE / LFREC_IDLE / LFREC_BUSY)
+    int refs;                       // 引用计数
+    unsigned long id;               // 所属纪元回收的编号
+    lfnode_t *limbo[3];             // 待回收链表
+    unsigned long limbo_epoch[3];   // 各待回收链表中节点摘除时的全局纪元
+    unsigned long seen;             // 上次回收时的全局纪元
+    int retired;                    // 自上次尝试推进纪元后摘除的节点数
+    struct _epoch_rec_t *next;      // 下一条线程记录
+    struct _epoch_rec_t *tnext;     // 所属线程在其他纪元回收中的下一条记录
+}epoch_rec_t;
+
+
+/**
+ * @brief 纪元回收定义
+ */
+typedef struct _epoch_t
+{
+    unsigned long global;           // 全局纪元
+    unsigned long id;               // 唯一编号(用于线程记录缓存)
+    epoch_rec_t *recs;              // 线程记录链表(只增不减)
+    op_t my_destroy;                // 释放节点时调用的销毁函数(可为 NULL)
+}epoch_t;
+
+
+/**
+ * @brief 风险指针的线程记录定义
+ * @details 每个访问过链表的线程一条记录, 待回收链表只由所属线程访问.
+ *          线程退出后记录转为空闲, 其待回收链表由扫描的线程接管, 记录由新线程接管;
+ *          引用计数规则同 epoch_rec_t
+ */
+typedef struct _hazard_rec_t
+{
+    lfnode_t *hp[HAZARD_PER_THREAD];// 风险指针(正在访问的节点)
+    int state;                      // 记录状态(LFREC_ACTIVE / LFREC_IDLE / LFREC_BUSY)
+    int refs;                       // 引用计数
+    unsigned long id;               // 所属风险指针回收的编号
+    lfnode_t *retired;              // 待回收链表
+    int nretired;                   // 待回收节点数
+    struct _hazard_rec_t *next;     // 下一条线程记录
+    struct _hazard_rec_t *tnext;    // 所属线程在其他风险指针回收中的下一条记录
+}hazard_rec_t;
+
+
+/**
+ * @brief 风险指针回收定义
+ */
+typedef struct _hazard_t
+{
+    hazard_rec_t *recs;             // 线程记录链表(只增不减)
+    int nrec;                       // 线程记录个数
+    unsigned long id;               // 唯一编号(用于线程记录缓存)
+}hazard_t;
+
+
+/**
+ * @brief 无锁链表头信息结构体定义
+ */
+typedef struct _lflist_t
+{
+    lfnode_t *head;                 // 指向链表的第一个节点
+    int size;                       // 存储数据的类型大小
+    int count;                      // 节点的个数(原子访问)
+    op_t my_destroy;                // 自定义销毁函数
+    order_t my_order;               // 三路比较函数
+    int flags;                      // 回收方式
+    epoch_t ebr;                    // 纪元回收(仅 LFLIST_EPOCH 方式使用)
+    hazard_t hzd;                   // 风险指针回收(仅 LFLIST_HAZARD 方式使用)
+}lflist_t;
+
+
+
+/**
+ * @brief           创建无锁链表头信息结构体(纪元回收)
+ * @param           存储数据类型大小
+ * @param           自定义销毁数据函数(只释放数据内部引用的资源, 可为 NULL)
+ * @param           三路比较函数(数据小于/等于/大于关键字时返回负数/0/正数)
+ * @return          指向链表头信息结构体的指针
+ *      @arg  PAR_ERROR:参数错误
+ *      @arg  FUN_ERROR:函数错误
+ */
+lflist_t *lflist_create(int size, op_t my_destroy, order_t my_order);
+
+
+/**
+ * @brief           按指定回收方式创建无锁链表头信息结构体
+ * @details         LFLIST_EPOCH 方式下读者只写自己的线程记录, 开销最小, 但有线程在
+ *                  临界区中停顿时纪元无法推进, 待回收节点不断累积.
+ *                  LFLIST_HAZARD 方式下每个线程的待回收节点数不超过扫描阈值,
+ *                  总量约为 线程数 x 风险指针个数 的常数倍, 不受停顿线程影响
+ * @param           存储数据类型大小
+ * @param           自定义销毁数据函数(只释放数据内部引用的资源, 可为 NULL)
+ * @param           三路比较函数(数据小于/等于/大于关键字时返回负数/0/正数)
+ * @param           回收方式(LFLIST_EPOCH / LFLIST_HAZARD)
+ * @return          指向链表头信息结构体的指针
+ *      @arg  PAR_ERROR:参数错误
+ *      @arg  FUN_ERROR:函数错误
+ */
+lflist_t *lflist_create_ex(int size, op_t my_destroy, order_t my_order, int flags);
+
+
+/**
+ * @brief           销毁链表及头信息结构体
+ * @details         须在其他线程不再访问链表后调用
+ * @param           头信息结构体的指针的地址
+ * @return          
+ *      @arg  0:正常
+ *      @arg  PAR_ERROR:参数错误
+ */
+int lflist_destroy(lflist_t **p);
+
+
+/**
+ * @brief           有序插入(插入到相等数据之后)
+ * @param           头信息结构体的指针
+ * @param           插入的数据
+ * @return          
+ *      @arg  0:正常
+ *      @arg  PAR_ERROR:参数错误
+ *      @arg  FUN_ERROR:函数错误
+ */
+int lflist_insert(lflist_t *lf, void *data);
+
+
+/**
+ * @brief           根据关键字删除第一个匹配的节点
+ * @details         在三路比较函数判定相等的节点中, 删除第一个比较函数匹配的节点.
+ *                  自定义销毁函数在节点回收时调用
+ * @param           头信息结构体的指针
+ * @param           关键字
+ * @param           自定义比较函数
+ * @return          
+ *      @arg  0:正常
+ *      @arg  PAR_ERROR:参数错误
+ *      @arg  FUN_ERROR:函数错误(无匹配节点)
+ */
+int lflist_delete_by_key(lflist_t *lf, void *key, cmp_t op_cmp);
+
+
+/**
+ * @brief           根据关键字获取第一个匹配节点的数据
+ * @param           头信息结构体的指针
+ * @param           获取的数据
+ * @param           关键字
+ * @param           自定义比较函数
+ * @return          
+ *      @arg  0:正常
+ *      @arg  PAR_ERROR:参数错误
+ *      @arg  FUN_ERROR:函数错误(无匹配节点)
+ */
+int lflist_retrieve_by_key(lflist_t *lf, void *data, void *key, cmp_t op_cmp);
+
+
+/**
+ * @brief           获取链表中节点的个数
+ * @param           头信息结构体的指针
+ * @return          链表节点个数
+ *      @arg  PAR_ERROR:参数错误
+ */
+int lflist_get_count(lflist_t *lf);
+
+
+/**
+ * @brief           遍历链表中未删除的节点
+ * @details         与其他线程的修改并发时, 结果为遍历过程中链表的某种中间状态.
+ *                  LFLIST_HAZARD 方式下当前节点被删除时从已打印的数据之后继续,
+ *                  可能遗漏与已打印数据相等的节点
+ * @param           头信息结构体的指针
+ * @param           自定义打印函数
+ * @return          
+ *      @arg  0:正常
+ *      @arg  PAR_ERROR:参数错误
+ *      @arg  FUN_ERROR:函数错误
+ */
+int lflist_traverse(lflist_t *lf, op_t my_print);
+
+
+
+
+#endif /* __UOLIST_LOCKFREE_H__ */
+
@@ -0,0 +1,334 @@
+/**
+ * @file                uolist_queue.c
+ * @brief               无锁多生产者多消费者队列(Michael-Scott 算法)
+ * @details             入队与出队都在纪元回收的临界区中进行, 出队时读取的后继节点
+ *                      在临界区结束前不会被释放. 出队后的原哑节点交给纪元回收,
+ *                      其数据已在更早的出队中交给调用者, 回收时不调用销毁函数
+ * @author              BHR
+ * @version             v1.2
+ * @date                2026-10-16
+ * @copyright           MIT
+ */
+
+#include "uolist_queue.h"
+#include "uolist_epoch.h"
+
+
+/**
+ * @brief           创建节点并写入数据
+ * @param           队列头信息结构体指针
+ * @param           数据(为 NULL 时创建哑节点)
+ * @return          节点指针, 失败返回 NULL
+ */
+static lfnode_t *__qnode_alloc(lfqueue_t *q, void *data)
+{
+    lfnode_t *node = NULL;
+
+    node = (lfnode_t *)malloc(sizeof(lfnode_t) + q->size);
+    if (NULL == node)
+    {
+    #ifdef DEBUG
+        printf("__qnode_alloc: malloc error\n");
+    #elif defined FILE_DEBUG
+        
+    #endif
+        return NULL;
+    } /* end of if (NULL == node) */
+
+    node->data = node->payload;
+    node->next = NULL;
+    node->retire = NULL;
+    if (NULL != data)
+    {
+        memcpy(node->data, data, q->size);
+    } /* end of if (NULL != data) */
+
+    return node;
+}
+
+
+
+/**
+ * @brief           创建无锁队列头信息结构体
+ * @param           存储数据类型大小
+ * @param           自定义销毁数据函数(只释放数据内部引用的资源, 可为 NULL)
+ * @return          指向队列头信息结构体的指针
+ *      @arg  PAR_ERROR:参数错误
+ *      @arg  FUN_ERROR:函数错误
+ */
+lfqueue_t *lfqueue_create(int size, op_t my_destroy)
+{
+    lfqueue_t *q = NULL;
+
+    /* 参数检查 */
+    if (size <= 0)
+    {
+    #ifdef DEBUG
+        printf("lfqueue_create: Parameter error\n");
+    #elif defined FILE_DEBUG
+        
+    #endif
+        goto ERR0;
+    } /* end of if (size <= 0) */
+
+    q = (lfqueue_t *)calloc(1, sizeof(lfqueue_t));
+    if (NULL == q)
+    {
+    #ifdef DEBUG
+        printf("lfqueue_create: calloc error\n");
+    #elif defined FILE_DEBUG
+        
+    #endif
+        goto ERR1;
+    } /* end of if (NULL == q) */
+    q->size = size;
+    q->my_destroy = my_destroy;
+
+    /* 头尾指针都指向哑节点 */
+    q->head = __qnode_alloc(q, NULL);
+    if (NULL == q->head)
+    {
+        goto ERR2;
+    } /* end of if (NULL == q->head) */
+    q->tail = q->head;
+
+    // 回收的节点中的数据都已交给调用者
+    epoch_init(&q->ebr, NULL);
+
+    return q;
+
+ERR0:
+    return (void *)PAR_ERROR;
+ERR2:
+    free(q);
+ERR1:
+    return (void *)FUN_ERROR;
+}
+
+
+/**
+ * @brief           销毁队列及头信息结构体
+ * @details         须在其他线程不再访问队列后调用, 仍在队列中的数据调用自定义销毁函数
+ * @param           头信息结构体的指针的地址
+ * @return          
+ *      @arg  0:正常
+ *      @arg  PAR_ERROR:参数错误
+ */
+int lfqueue_destroy(lfqueue_t **p)
+{
+    lfnode_t *temp = NULL;
+    lfnode_t *save = NULL;
+
+    /* 参数检查 */
+    if (NULL == p || NULL == *p)
+    {
+    #ifdef DEBUG
+        printf("lfqueue_destroy: Parameter error\n");
+    #elif defined FILE_DEBUG
+        
+    #endif
+        goto ERR0;
+    } /* end of if (NULL == p || NULL == *p) */
+
+    /* 1.释放哑节点及队列中的节点 */
+    for (temp = (*p)->head; NULL != temp; temp = save)
+    {
+        save = temp->next;
+        if (temp != (*p)->head && NULL != (*p)->my_destroy)
+        {
+            (*p)->my_destroy(temp->data);
+        } /* end of if (temp != (*p)->head && NULL != (*p)->my_destroy) */
+        free(temp);
+    } /* end of for (temp = (*p)->head; NULL != temp; temp = save) */
+
+    /* 2.释放已出队的节点 */
+    epoch_release(&(*p)->ebr);
+
+    free(*p);
+    *p = NULL;
+
+    return 0;
+
+ERR0:
+    return PAR_ERROR;
+}
+
+
+/**
+ * @brief           入队(队尾插入)
+ * @param           头信息结构体的指针
+ * @param           入队的数据
+ * @return          
+ *      @arg  0:正常
+ *      @arg  PAR_ERROR:参数错误
+ *      @arg  FUN_ERROR:函数错误
+ */
+int lfqueue_push(lfqueue_t *q, void *data)
+{
+    epoch_rec_t *rec = NULL;
+    lfnode_t *node = NULL;
+    lfnode_t *tail = NULL;
+    lfnode_t *next = NULL;
+
+    /* 参数检查 */
+    if (NULL == q || NULL == data)
+    {
+    #ifdef DEBUG
+        printf("lfqueue_push: Parameter error\n");
+    #elif defined FILE_DEBUG
+        
+    #endif
+        goto ERR0;
+    } /* end of if (NULL == q || NULL == data) */
+
+    /* 1.创建节点(发布前其他线程不可见) */
+    node = __qnode_alloc(q, data);
+    if (NULL == node)
+    {
+        goto ERR1;
+    } /* end of if (NULL == node) */
+
+    rec = epoch_enter(&q->ebr);
+    if (NULL == rec)
+    {
+        goto ERR2;
+    } /* end of if (NULL == rec) */
+
+    /* 2.连接到队尾节点之后, 尾指针落后时先帮助推进 */
+    while (1)
+    {
+        tail = __atomic_load_n(&q->tail, __ATOMIC_ACQUIRE);
+        next = __atomic_load_n(&tail->next, __ATOMIC_ACQUIRE);
+        if (NULL != next)
+        {
+            __atomic_compare_exchange_n(&q->tail, &tail, next, 0, __ATOMIC_RELEASE, __ATOMIC_RELAXED);
+            continue;
+        } /* end of if (NULL != next) */
+        if (__atomic_compare_exchange_n(&tail->next, &next, node, 0, __ATOMIC_RELEASE, __ATOMIC_RELAXED))
+        {
+            break;
+        } /* end of if (__atomic_compare_exchange_n(&tail->next, &next, node, ...)) */
+    } /* end of while (1) */
+
+    /* 3.推进尾指针, 失败说明其他线程已帮助推进 */
+    __atomic_compare_exchange_n(&q->tail, &tail, node, 0, __ATOMIC_RELEASE, __ATOMIC_RELAXED);
+    epoch_exit(rec);
+
+    return 0;
+
+ERR0:
+    return PAR_ERROR;
+ERR2:
+    free(node);
+ERR1:
+    return FUN_ERROR;
+}
+
+
+/**
+ * @brief           出队(队首删除)
+ * @details         队首数据拷贝给调用者, 数据的所有权随之转移, 不调用自定义销毁函数
+ * @param           头信息结构体的指针
+ * @param           获取的数据
+ * @return          
+ *      @arg  0:正常
+ *      @arg  PAR_ERROR:参数错误
+ *      @arg  FUN_ERROR:函数错误(队列为空)
+ */
+int lfqueue_pop(lfqueue_t *q, void *data)
+{
+    epoch_rec_t *rec = NULL;
+    lfnode_t *head = NULL;
+    lfnode_t *tail = NULL;
+    lfnode_t *next = NULL;
+
+    /* 参数检查 */
+    if (NULL == q || NULL == data)
+    {
+    #ifdef DEBUG
+        printf("lfqueue_pop: Parameter error\n");
+    #elif defined FILE_DEBUG
+        
+    #endif
+        goto ERR0;
+    } /* end of if (NULL == q || NULL == data) */
+
+    rec = epoch_enter(&q->ebr);
+    if (NULL == rec)
+    {
+        goto ERR1;
+    } /* end of if (NULL == rec) */
+
+    /* 1.先拷贝数据, 再用 CAS 移动头指针, 失败时重新读取 */
+    while (1)
+    {
+        head = __atomic_load_n(&q->head, __ATOMIC_ACQUIRE);
+        next = __atomic_load_n(&head->next, __ATOMIC_ACQUIRE);
+        if (NULL == next)
+        {
+            epoch_exit(rec);
+            goto ERR1;
+        } /* end of if (NULL == next) */
+
+        // 尾指针仍指向将要出队的哑节点时先帮助推进
+        tail = __atomic_load_n(&q->tail, __ATOMIC_ACQUIRE);
+        if (head == tail)
+        {
+            __atomic_compare_exchange_n(&q->tail, &tail, next, 0, __ATOMIC_RELEASE, __ATOMIC_RELAXED);
+        } /* end of if (head == tail) */
+
+        memcpy(data, next->data, q->size);
+        if (__atomic_compare_exchange_n(&q->head, &head, next, 0, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED))
+        {
+            break;
+        } /* end of if (__atomic_compare_exchange_n(&q->head, &head, next, ...)) */
+    } /* end of while (1) */
+
+    /* 2.原哑节点交给纪元回收 */
+    epoch_retire(&q->ebr, rec, head);
+    epoch_exit(rec);
+
+    return 0;
+
+ERR0:
+    return PAR_ERROR;
+ERR1:
+    return FUN_ERROR;
+}
+
+
+/**
+ * @brief           判断队列是否为空
+ * @param           头信息结构体的指针
+ * @return          
+ *      @arg  1:队列为空
+ *      @arg  0:队列不为空
+ *      @arg  PAR_ERROR:参数错误
+ */
+int lfqueue_is_empty(lfqueue_t *q)
+{
+    epoch_rec_t *rec = NULL;
+    int empty = 0;
+
+    /* 参数检查 */
+    if (NULL == q)
+    {
+    #ifdef DEBUG
+        printf("lfqueue_is_empty: Parameter error\n");
+    #elif defined FILE_DEBUG
+        
+    #endif
+        return PAR_ERROR;
+    } /* end of if (NULL == q) */
+
+    // 读取哑节点的指针域须在临界区中进行
+    rec = epoch_enter(&q->ebr);
+    if (NULL == rec)
+    {
+        return FUN_ERROR;
+    } /* end of if (NULL == rec) */
+    empty = (NULL == __atomic_load_n(&__atomic_load_n(&q->head, __ATOMIC_ACQUIRE)->next, __ATOMIC_ACQUIRE));
+    epoch_exit(rec);
+
+    return empty;
+}
@@ -0,0 +1,98 @@
+/**
+ * @file                uolist_queue.h
+ * @brief               无锁多生产者多消费者队列(Michael-Scott 算法)
+ * @details             单向链表加哑节点: 入队在尾部 CAS 连接新节点, 出队 CAS 移动头指针,
+ *                      原哑节点的后继成为新的哑节点, 其数据拷贝给调用者.
+ *                      尾指针可能落后一个节点, 遇到时先帮助推进.
+ *                      出队的节点按纪元回收, 可在任意多个线程中同时入队/出队
+ * @author              BHR
+ * @version             v1.2
+ * @date                2026-10-16
+ * @copyright           MIT
+ */
+
+#ifndef __UOLIST_QUEUE_H__
+#define __UOLIST_QUEUE_H__
+
+#include "uolist_lockfree.h"
+
+
+/**
+ * @brief 无锁队列头信息结构体定义
+ * @details 头尾指针分别独占缓存行, 生产者与消费者互不干扰
+ */
+typedef struct _lfqueue_t
+{
+    lfnode_t *head;                 // 哑节点(其后继为队首)
+    char pad1[CACHE_LINE_SIZE - sizeof(lfnode_t *)];
+    lfnode_t *tail;                 // 队尾节点(可能落后一个节点)
+    char pad2[CACHE_LINE_SIZE - sizeof(lfnode_t *)];
+    int size;                       // 存储数据的类型大小
+    op_t my_destroy;                // 自定义销毁函数(只用于销毁时仍在队列中的数据)
+    epoch_t ebr;                    // 纪元回收
+}lfqueue_t;
+
+
+
+/**
+ * @brief           创建无锁队列头信息结构体
+ * @param           存储数据类型大小
+ * @param           自定义销毁数据函数(只释放数据内部引用的资源, 可为 NULL)
+ * @return          指向队列头信息结构体的指针
+ *      @arg  PAR_ERROR:参数错误
+ *      @arg  FUN_ERROR:函数错误
+ */
+lfqueue_t *lfqueue_create(int size, op_t my_destroy);
+
+
+/**
+ * @brief           销毁队列及头信息结构体
+ * @details         须在其他线程不再访问队列后调用, 仍在队列中的数据调用自定义销毁函数
+ * @param           头信息结构体的指针的地址
+ * @return          
+ *      @arg  0:正常
+ *      @arg  PAR_ERROR:参数错误
+ */
+int lfqueue_destroy(lfqueue_t **p);
+
+
+/**
+ * @brief           入队(队尾插入)
+ * @param           头信息结构体的指针
+ * @param           入队的数据
+ * @return          
+ *      @arg  0:正常
+ *      @arg  PAR_ERROR:参数错误
+ *      @arg  FUN_ERROR:函数错误
+ */
+int lfqueue_push(lfqueue_t *q, void *data);
+
+
+/**
+ * @brief           出队(队首删除)
+ * @details         队首数据拷贝给调用者, 数据的所有权随之转移, 不调用自定义销毁函数
+ * @param           头信息结构体的指针
+ * @param           获取的数据
+ * @return          
+ *      @arg  0:正常
+ *      @arg  PAR_ERROR:参数错误
+ *      @arg  FUN_ERROR:函数错误(队列为空)
+ */
+int lfqueue_pop(lfqueue_t *q, void *data);
+
+
+/**
+ * @brief           判断队列是否为空
+ * @param           头信息结构体的指针
+ * @return          
+ *      @arg  1:队列为空
+ *      @arg  0:队列不为空
+ *      @arg  PAR_ERROR:参数错误
+ */
+int lfqueue_is_empty(lfqueue_t *q);
+
+
+
+
+#endif /* __UOLIST_QUEUE_H__ */
+
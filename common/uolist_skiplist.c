@@ -0,0 +1,460 @@
+/**
+ * @file                uolist_skiplist.c
+ * @brief               万能型单向链表的跳表索引
+ * @details             链表本身作为跳表最底层, 约 1/4 的节点带有索引节点,
+ *                      每层记录到后继的跨度, 按索引定位时逐层下降, 期望 O(log n).
+ *                      节点排名从 1 开始, 头索引节点排名为 0; 本层没有后继时,
+ *                      跨度记为 count + 1 - 排名
+ * @author              BHR
+ * @version             v1.2
+ * @date                2026-10-16
+ * @copyright           MIT
+ */
+
+#include "uolist_skiplist.h"
+
+/**
+ * @brief           计算带有指定层数的索引节点大小
+ * @param           层数
+ * @return          索引节点大小(字节)
+ */
+static size_t __sknode_size(int level)
+{
+    return sizeof(sknode_t) + (size_t)level * sizeof(((sknode_t *)0)->lv[0]);
+}
+
+
+/**
+ * @brief           随机生成新节点的索引层数(每层概率 1/4)
+ * @param           链表头信息结构体指针
+ * @return          层数(0 表示不建立索引节点)
+ */
+static int __sk_level(uolist_t *uo)
+{
+    unsigned int s = uo->skseed;
+    int level = 0;
+
+    for (;;)
+    {
+        /* xorshift32 */
+        s ^= s << 13;
+        s ^= s >> 17;
+        s ^= s << 5;
+        if (level >= SKIP_MAX_LEVEL || 0 != (s & 3))
+        {
+            break;
+        } /* end of if (level >= SKIP_MAX_LEVEL || 0 != (s & 3)) */
+        level++;
+    } /* end of for (;;) */
+    uo->skseed = s;
+
+    return level;
+}
+
+
+/**
+ * @brief           从索引节点出发, 沿链表走到指定排名的节点
+ * @param           链表头信息结构体指针
+ * @param           出发的索引节点
+ * @param           出发索引节点的排名
+ * @param           目标排名(为 0 时返回 NULL)
+ * @return          目标链表节点
+ */
+static node_t *__sk_walk(uolist_t *uo, sknode_t *x, int pos, int rank)
+{
+    node_t *p = NULL;
+
+    if (0 == rank)
+    {
+        return NULL;
+    } /* end of if (0 == rank) */
+
+    /* 头索引节点没有对应的链表节点, 从第一个节点出发 */
+    if (x == uo->skhead)
+    {
+        p = uo->fstnode_p;
+        pos = 1;
+    }
+    else
+    {
+        p = x->node;
+    }
+    for (; pos < rank; pos++)
+    {
+        p = p->next;
+    } /* end of for (; pos < rank; pos++) */
+
+    return p;
+}
+
+
+/**
+ * @brief           查找每层中排名小于目标排名的最后一个索引节点
+ * @param           链表头信息结构体指针
+ * @param           目标排名
+ * @param           保存各层索引节点的数组
+ * @param           保存各层索引节点排名的数组
+ * @return          无
+ */
+static void __sk_search(uolist_t *uo, int rank, sknode_t **update, int *pos)
+{
+    sknode_t *x = uo->skhead;
+    int p = 0;
+    int l = 0;
+
+    for (l = SKIP_MAX_LEVEL - 1; l >= 0; l--)
+    {
+        while (NULL != x->lv[l].next && p + x->lv[l].span < rank)
+        {
+            p += x->lv[l].span;
+            x = x->lv[l].next;
+        } /* end of while (NULL != x->lv[l].next && p + x->lv[l].span < rank) */
+        update[l] = x;
+        pos[l] = p;
+    } /* end of for (l = SKIP_MAX_LEVEL - 1; l >= 0; l--) */
+}
+
+
+/**
+ * @brief           释放除头索引节点外的全部索引节点, 并复位头索引节点
+ * @param           链表头信息结构体指针
+ * @return          无
+ */
+static void __sk_clear(uolist_t *uo)
+{
+    sknode_t *x = NULL;
+    sknode_t *save = NULL;
+    int l = 0;
+
+    // 每个索引节点至少有一层, 沿最低层即可访问全部索引节点
+    for (x = uo->skhead->lv[0].next; NULL != x; x = save)
+    {
+        save = x->lv[0].next;
+        free(x);
+    } /* end of for (x = uo->skhead->lv[0].next; NULL != x; x = save) */
+
+    for (l = 0; l < SKIP_MAX_LEVEL; l++)
+    {
+        uo->skhead->lv[l].next = NULL;
+        uo->skhead->lv[l].span = uo->count + 1;
+    } /* end of for (l = 0; l < SKIP_MAX_LEVEL; l++) */
+    uo->sklevel = 0;
+}
+
+
+
+/**
+ * @brief           创建跳表头索引节点
+ * @param           头信息结构体的指针
+ * @return
+ *      @arg  0:正常
+ *      @arg  FUN_ERROR:函数错误
+ */
+int skiplist_init(uolist_t *uo)
+{
+    uo->skhead = (sknode_t *)malloc(__sknode_size(SKIP_MAX_LEVEL));
+    if (NULL == uo->skhead)
+    {
+    #ifdef DEBUG
+        printf("skiplist_init: malloc error\n");
+    #elif defined FILE_DEBUG
+
+    #endif
+        return FUN_ERROR;
+    } /* end of if (NULL == uo->skhead) */
+
+    uo->skhead->lv[0].next = NULL;
+    uo->skhead->node = NULL;
+    uo->skseed = 2463534242u;
+    __sk_clear(uo);
+    uo->skdirty = 0;
+
+    return 0;
+}
+
+
+/**
+ * @brief           释放全部索引节点(包括头索引节点)
+ * @param           头信息结构体的指针
+ * @return          0
+ */
+int skiplist_release(uolist_t *uo)
+{
+    if (NULL != uo->skhead)
+    {
+        __sk_clear(uo);
+        free(uo->skhead);
+        uo->skhead = NULL;
+    } /* end of if (NULL != uo->skhead) */
+
+    return 0;
+}
+
+
+/**
+ * @brief           索引失效时根据链表重建索引
+ * @param           头信息结构体的指针
+ * @return          0
+ */
+int skiplist_sync(uolist_t *uo)
+{
+    sknode_t *last[SKIP_MAX_LEVEL];
+    int last_rank[SKIP_MAX_LEVEL];
+    sknode_t *t = NULL;
+    node_t *p = NULL;
+    int rank = 0;
+    int level = 0;
+    int l = 0;
+
+    if (!uo->skdirty)
+    {
+        return 0;
+    } /* end of if (!uo->skdirty) */
+
+    /* 1.释放原有索引 */
+    __sk_clear(uo);
+    for (l = 0; l < SKIP_MAX_LEVEL; l++)
+    {
+        last[l] = uo->skhead;
+        last_rank[l] = 0;
+    } /* end of for (l = 0; l < SKIP_MAX_LEVEL; l++) */
+
+    /* 2.顺序遍历链表, 依次接入各层末尾 */
+    for (p = uo->fstnode_p, rank = 1; NULL != p; p = p->next, rank++)
+    {
+        level = __sk_level(uo);
+        if (0 == level)
+        {
+            continue;
+        } /* end of if (0 == level) */
+
+        // 申请失败时该节点不建立索引, 不影响正确性
+        t = (sknode_t *)malloc(__sknode_size(level));
+        if (NULL == t)
+        {
+            continue;
+        } /* end of if (NULL == t) */
+
+        t->node = p;
+        for (l = 0; l < level; l++)
+        {
+            t->lv[l].next = NULL;
+            last[l]->lv[l].next = t;
+            last[l]->lv[l].span = rank - last_rank[l];
+            last[l] = t;
+            last_rank[l] = rank;
+        } /* end of for (l = 0; l < level; l++) */
+        if (level > uo->sklevel)
+        {
+            uo->sklevel = level;
+        } /* end of if (level > uo->sklevel) */
+    } /* end of for (p = uo->fstnode_p, rank = 1; NULL != p; p = p->next, rank++) */
+
+    /* 3.各层末尾的跨度指向链表末尾之后 */
+    for (l = 0; l < SKIP_MAX_LEVEL; l++)
+    {
+        last[l]->lv[l].span = uo->count + 1 - last_rank[l];
+    } /* end of for (l = 0; l < SKIP_MAX_LEVEL; l++) */
+
+    uo->skdirty = 0;
+
+    return 0;
+}
+
+
+/**
+ * @brief           根据索引获取链表节点
+ * @param           头信息结构体的指针
+ * @param           索引值(0 <= index < count)
+ * @return          链表节点指针
+ */
+node_t *skiplist_at(uolist_t *uo, int index)
+{
+    sknode_t *x = uo->skhead;
+    int rank = index + 1;
+    int pos = 0;
+    int l = 0;
+
+    for (l = uo->sklevel - 1; l >= 0; l--)
+    {
+        while (NULL != x->lv[l].next && pos + x->lv[l].span <= rank)
+        {
+            pos += x->lv[l].span;
+            x = x->lv[l].next;
+        } /* end of while (NULL != x->lv[l].next && pos + x->lv[l].span <= rank) */
+    } /* end of for (l = uo->sklevel - 1; l >= 0; l--) */
+
+    return __sk_walk(uo, x, pos, rank);
+}
+
+
+/**
+ * @brief           在索引位置插入链表节点并维护索引
+ * @param           头信息结构体的指针
+ * @param           索引值(大于等于节点个数时插入到尾部)
+ * @param           要插入的链表节点
+ * @return          0
+ */
+int skiplist_link(uolist_t *uo, int index, node_t *p)
+{
+    sknode_t *update[SKIP_MAX_LEVEL];
+    int pos[SKIP_MAX_LEVEL];
+    sknode_t *t = NULL;
+    node_t *prev = NULL;
+    int rank = 0;
+    int level = 0;
+    int l = 0;
+
+    /* 1.定位各层的前驱索引节点及链表前驱 */
+    rank = (index < uo->count ? index : uo->count) + 1;
+    __sk_search(uo, rank, update, pos);
+    prev = (rank - 1 == uo->count) ? uo->lstnode_p : __sk_walk(uo, update[0], pos[0], rank - 1);
+
+    /* 2.连接链表节点 */
+    if (NULL == prev)
+    {
+        p->next = uo->fstnode_p;
+        uo->fstnode_p = p;
+    }
+    else
+    {
+        p->next = prev->next;
+        prev->next = p;
+    }
+    if (uo->lstnode_p == prev)
+    {
+        uo->lstnode_p = p;
+    } /* end of if (uo->lstnode_p == prev) */
+    uo->count++;
+
+    /* 3.建立索引节点, 申请失败时该节点不建立索引 */
+    level = __sk_level(uo);
+    if (level > 0)
+    {
+        t = (sknode_t *)malloc(__sknode_size(level));
+        if (NULL == t)
+        {
+            level = 0;
+        } /* end of if (NULL == t) */
+    } /* end of if (level > 0) */
+
+    /* 4.刷新各层跨度 */
+    for (l = 0; l < SKIP_MAX_LEVEL; l++)
+    {
+        if (l < level)
+        {
+            t->lv[l].next = update[l]->lv[l].next;
+            t->lv[l].span = update[l]->lv[l].span + 1 - (rank - pos[l]);
+            update[l]->lv[l].next = t;
+            update[l]->lv[l].span = rank - pos[l];
+        }
+        else
+        {
+            update[l]->lv[l].span++;
+        }
+    } /* end of for (l = 0; l < SKIP_MAX_LEVEL; l++) */
+    if (level > 0)
+    {
+        t->node = p;
+    } /* end of if (level > 0) */
+    if (level > uo->sklevel)
+    {
+        uo->sklevel = level;
+    } /* end of if (level > uo->sklevel) */
+
+    return 0;
+}
+
+
+/**
+ * @brief           摘除索引位置的链表节点并维护索引
+ * @param           头信息结构体的指针
+ * @param           索引值(0 <= index < count)
+ * @return          被摘除的链表节点(由调用者释放)
+ */
+node_t *skiplist_unlink(uolist_t *uo, int index)
+{
+    sknode_t *update[SKIP_MAX_LEVEL];
+    int pos[SKIP_MAX_LEVEL];
+    sknode_t *t = NULL;
+    node_t *prev = NULL;
+    node_t *des = NULL;
+    int rank = index + 1;
+    int l = 0;
+
+    /* 1.定位各层的前驱索引节点及要删除节点的索引节点 */
+    __sk_search(uo, rank, update, pos);
+    t = update[0]->lv[0].next;
+    if (NULL != t && pos[0] + update[0]->lv[0].span != rank)
+    {
+        t = NULL;
+    } /* end of if (NULL != t && pos[0] + update[0]->lv[0].span != rank) */
+
+    /* 2.刷新各层跨度 */
+    for (l = 0; l < SKIP_MAX_LEVEL; l++)
+    {
+        if (NULL != t && update[l]->lv[l].next == t)
+        {
+            update[l]->lv[l].span += t->lv[l].span - 1;
+            update[l]->lv[l].next = t->lv[l].next;
+        }
+        else
+        {
+            update[l]->lv[l].span--;
+        }
+    } /* end of for (l = 0; l < SKIP_MAX_LEVEL; l++) */
+    free(t);
+    while (uo->sklevel > 0 && NULL == uo->skhead->lv[uo->sklevel - 1].next)
+    {
+        uo->sklevel--;
+    } /* end of while (uo->sklevel > 0 && NULL == uo->skhead->lv[uo->sklevel - 1].next) */
+
+    /* 3.摘除链表节点 */
+    prev = __sk_walk(uo, update[0], pos[0], rank - 1);
+    if (NULL == prev)
+    {
+        des = uo->fstnode_p;
+        uo->fstnode_p = des->next;
+    }
+    else
+    {
+        des = prev->next;
+        prev->next = des->next;
+    }
+    if (uo->lstnode_p == des)
+    {
+        uo->lstnode_p = prev;
+    } /* end of if (uo->lstnode_p == des) */
+    uo->count--;
+
+    return des;
+}
+
+
+/**
+ * @brief           按三路比较函数定位(链表须有序, 索引须有效)
+ * @param           头信息结构体的指针
+ * @param           关键字
+ * @param           三路比较函数
+ * @param           为 0 时跳过小于关键字的节点, 否则跳过小于等于关键字的节点
+ * @param           保存返回索引节点排名的指针
+ * @return          最后一个被跳过的索引节点(没有时为头索引节点)
+ */
+sknode_t *skiplist_seek(uolist_t *uo, void *key, order_t my_order, int upper, int *rank)
+{
+    sknode_t *x = uo->skhead;
+    int pos = 0;
+    int l = 0;
+
+    for (l = uo->sklevel - 1; l >= 0; l--)
+    {
+        while (NULL != x->lv[l].next && my_order(x->lv[l].next->node->data, key) < upper)
+        {
+            pos += x->lv[l].span;
+            x = x->lv[l].next;
+        } /* end of while (NULL != x->lv[l].next && my_order(...) < upper) */
+    } /* end of for (l = uo->sklevel - 1; l >= 0; l--) */
+    *rank = pos;
+
+    return x;
+}
@@ -0,0 +1,51 @@
+/**
+ * @file                uolist_sort.h
+ * @brief               万能型单向链表的排序
+ * @details             供 uni_oneway_linkedlist.c 调用, 调用者负责参数检查;
+ *                      排序只重新连接节点, 不移动数据
+ * @author              BHR
+ * @version             v1.2
+ * @date                2026-10-16
+ * @copyright           MIT
+ */
+
+#ifndef __UOLIST_SORT_H__
+#define __UOLIST_SORT_H__
+
+#include "uni_oneway_linkedlist.h"
+
+
+/**
+ * @brief           自底向上的自然归并排序(稳定)
+ * @param           头信息结构体的指针
+ * @param           三路比较函数
+ * @return          0
+ */
+int sort_merge(uolist_t *uo, order_t my_order);
+
+
+/**
+ * @brief           按字节的最低位优先基数排序(稳定)
+ * @param           头信息结构体的指针
+ * @param           自定义关键字提取函数
+ * @return
+ *      @arg  0:正常
+ *      @arg  FUN_ERROR:函数错误(链表不变)
+ */
+int sort_radix(uolist_t *uo, radix_t my_key);
+
+
+/**
+ * @brief           多线程归并排序(稳定)
+ * @param           头信息结构体的指针
+ * @param           三路比较函数(须可在多个线程中同时调用)
+ * @param           线程数(小于等于 0 时使用在线的处理器个数)
+ * @return          0
+ */
+int sort_parallel(uolist_t *uo, order_t my_order, int nthreads);
+
+
+
+
+#endif /* __UOLIST_SORT_H__ */
+
@@ -0,0 +1,183 @@
+/**
+ * @file                uolist_unrolled.h
+ * @brief               万能型单向链表的展开链表存储模式
+ * @details             供 uni_oneway_linkedlist.c 在 UOLIST_UNROLLED 模式下调用,
+ *                      调用者负责参数检查, 索引均已保证在有效范围内
+ * @author              BHR
+ * @version             v1.2
+ * @date                2026-10-16
+ * @copyright           MIT
+ */
+
+#ifndef __UOLIST_UNROLLED_H__
+#define __UOLIST_UNROLLED_H__
+
+#include "uni_oneway_linkedlist.h"
+
+
+/**
+ * @brief           在索引位置插入一个数据空间
+ * @param           头信息结构体的指针
+ * @param           索引值(大于等于节点个数时插入到尾部)
+ * @return          新数据空间的指针(未初始化), 失败返回 NULL
+ */
+void *unrolled_insert(uolist_t *uo, int index);
+
+
+/**
+ * @brief           删除索引位置的数据
+ * @param           头信息结构体的指针
+ * @param           索引值(0 <= index < count)
+ * @return          0
+ */
+int unrolled_delete(uolist_t *uo, int index);
+
+
+/**
+ * @brief           获取索引位置的数据
+ * @param           头信息结构体的指针
+ * @param           索引值(0 <= index < count)
+ * @return          数据的指针
+ */
+void *unrolled_at(uolist_t *uo, int index);
+
+
+/**
+ * @brief           根据关键字查找第一个匹配的数据
+ * @param           头信息结构体的指针
+ * @param           关键字
+ * @param           自定义比较函数
+ * @param           保存匹配索引的指针, 可为 NULL
+ * @return          匹配数据的指针, 无匹配时返回 NULL
+ */
+void *unrolled_find(uolist_t *uo, void *key, cmp_t op_cmp, int *index);
+
+
+/**
+ * @brief           根据关键字删除第一个匹配的数据
+ * @param           头信息结构体的指针
+ * @param           关键字
+ * @param           自定义比较函数
+ * @return
+ *      @arg  0:正常
+ *      @arg  FUN_ERROR:无匹配数据
+ */
+int unrolled_delete_by_key(uolist_t *uo, void *key, cmp_t op_cmp);
+
+
+/**
+ * @brief           根据关键字删除所有匹配的数据(单次遍历)
+ * @param           头信息结构体的指针
+ * @param           关键字
+ * @param           自定义比较函数
+ * @return          删除的数据个数
+ */
+int unrolled_delete_all_by_key(uolist_t *uo, void *key, cmp_t op_cmp);
+
+
+/**
+ * @brief           根据关键字修改所有匹配的数据(单次遍历)
+ * @param           头信息结构体的指针
+ * @param           修改的数据(为 NULL 时调用自定义更新函数)
+ * @param           关键字
+ * @param           自定义比较函数
+ * @param           自定义更新函数
+ * @return          修改的数据个数
+ */
+int unrolled_modify_all_by_key(uolist_t *uo, void *data, void *key, cmp_t op_cmp, op_t my_update);
+
+
+/**
+ * @brief           根据关键字查找所有匹配的索引, 依次尾插到索引链表
+ * @param           头信息结构体的指针
+ * @param           关键字
+ * @param           自定义比较函数
+ * @param           索引链表
+ * @return          0
+ */
+int unrolled_find_all_index(uolist_t *uo, void *key, cmp_t op_cmp, uolist_t *index_head);
+
+
+/**
+ * @brief           遍历所有数据
+ * @param           头信息结构体的指针
+ * @param           自定义打印数据函数
+ * @return          0
+ */
+int unrolled_traverse(uolist_t *uo, op_t my_print);
+
+
+/**
+ * @brief           销毁所有数据及展开节点
+ * @param           头信息结构体的指针
+ * @return          0
+ */
+int unrolled_destroy(uolist_t *uo);
+
+
+/**
+ * @brief           翻转链表
+ * @param           头信息结构体的指针
+ * @return          0
+ */
+int unrolled_reverse(uolist_t *uo);
+
+
+/**
+ * @brief           将全部数据依次导出到连续空间
+ * @param           头信息结构体的指针
+ * @param           导出空间(至少 count * size 字节)
+ * @return          0
+ */
+int unrolled_to_array(uolist_t *uo, void *buf);
+
+
+/**
+ * @brief           由连续数组批量尾部插入
+ * @param           头信息结构体的指针
+ * @param           连续存放的 n 个数据
+ * @param           数据个数
+ * @return
+ *      @arg  0:正常
+ *      @arg  FUN_ERROR:函数错误(链表不变)
+ */
+int unrolled_append_bulk(uolist_t *uo, void *data, int n);
+
+
+/**
+ * @brief           由连续数组批量头部插入
+ * @param           头信息结构体的指针
+ * @param           连续存放的 n 个数据
+ * @param           数据个数
+ * @return
+ *      @arg  0:正常
+ *      @arg  FUN_ERROR:函数错误(链表不变)
+ */
+int unrolled_prepend_bulk(uolist_t *uo, void *data, int n);
+
+
+/**
+ * @brief           将源链表的全部展开节点接到目标链表尾部
+ * @param           目标链表头信息结构体的指针
+ * @param           源链表头信息结构体的指针(完成后为空)
+ * @return          0
+ */
+int unrolled_concat(uolist_t *dst, uolist_t *src);
+
+
+/**
+ * @brief           从索引位置起的数据移到另一个空链表
+ * @param           头信息结构体的指针
+ * @param           索引值(0 < index < count)
+ * @param           接收后半部分的空链表
+ * @return
+ *      @arg  0:正常
+ *      @arg  FUN_ERROR:函数错误(链表不变)
+ */
+int unrolled_split(uolist_t *uo, int index, uolist_t *dst);
+
+
+
+
+#endif /* __UOLIST_UNROLLED_H__ */
+
@@ -0,0 +1,273 @@
+/* 并发链表吞吐量基准测试(make bench) */
+#include <stdio.h>
+#include <time.h>
+#include <sched.h>
+#include <pthread.h>
+#include "uni_oneway_linkedlist.h"
+#include "uolist_lockfree.h"
+#include "uolist_queue.h"
+
+// 关键字范围(预先插入偶数关键字; 须为最大线程数的整数倍)
+#define BENCH_KEY_RANGE 256
+// 每个线程的操作次数
+#define BENCH_OPS 50000
+// 最大线程数
+#define BENCH_MAX_THREAD 16
+
+/* 自定义三路比较函数 */
+int data_order(void *data, void *key)
+{
+    return (*(int *)data > *(int *)key) - (*(int *)data < *(int *)key);
+}
+
+/* 自定义关键字比较函数 */
+int data_compare(void *data, void *key)
+{
+    return (*(int *)data == *(int *)key) ? MATCH_SUCCESS : MATCH_FAIL;
+}
+
+/* 线程参数 */
+typedef struct _bench_arg_t
+{
+    void *list;                     // 被测链表
+    unsigned int seed;              // 随机数种子
+    int ops;                        // 操作次数
+    int id;                         // 线程编号
+    int nthread;                    // 线程数
+    pthread_barrier_t *start;       // 各线程就绪后同时开始
+    char present[BENCH_KEY_RANGE];  // 本线程负责的关键字是否在链表中
+}bench_arg_t;
+
+/* 线程私有的随机数(xorshift) */
+static unsigned int __rand(unsigned int *seed)
+{
+    *seed ^= *seed << 13;
+    *seed ^= *seed >> 17;
+    *seed ^= *seed << 5;
+    return *seed;
+}
+
+/*
+ * 线程 id 只修改 key % nthread == id 的关键字, 存在则删除, 不存在则插入,
+ * 链表始终保持同一组关键字(约一半), 不会因重复插入而增长
+ */
+static int __own_key(bench_arg_t *a, unsigned int r)
+{
+    return (r >> 8) % (BENCH_KEY_RANGE / a->nthread) * a->nthread + a->id;
+}
+
+/* 读写锁链表: 20% 插入或删除, 80% 查找 */
+static void *__rwlock_worker(void *arg)
+{
+    bench_arg_t *a = (bench_arg_t *)arg;
+    unsigned int r = 0;
+    int key = 0;
+    int i = 0;
+
+    pthread_barrier_wait(a->start);
+    for (i = 0; i < a->ops; i++)
+    {
+        r = __rand(&a->seed);
+        if (r % 10 >= 2)
+        {
+            key = (r >> 8) % BENCH_KEY_RANGE;
+            uolist_find_sorted((uolist_t *)a->list, &key);
+            continue;
+        }
+        key = __own_key(a, r);
+        if (a->present[key])
+        {
+            uolist_delete_sorted((uolist_t *)a->list, &key);
+        }
+        else
+        {
+            uolist_insert_sorted((uolist_t *)a->list, &key);
+        }
+        a->present[key] = !a->present[key];
+    }
+
+    return NULL;
+}
+
+/* 无锁链表: 20% 插入或删除, 80% 查找 */
+static void *__lockfree_worker(void *arg)
+{
+    bench_arg_t *a = (bench_arg_t *)arg;
+    unsigned int r = 0;
+    int key = 0;
+    int temp = 0;
+    int i = 0;
+
+    pthread_barrier_wait(a->start);
+    for (i = 0; i < a->ops; i++)
+    {
+        r = __rand(&a->seed);
+        if (r % 10 >= 2)
+        {
+            key = (r >> 8) % BENCH_KEY_RANGE;
+            lflist_retrieve_by_key((lflist_t *)a->list, &temp, &key, data_compare);
+            continue;
+        }
+        key = __own_key(a, r);
+        if (a->present[key])
+        {
+            lflist_delete_by_key((lflist_t *)a->list, &key, data_compare);
+        }
+        else
+        {
+            lflist_insert((lflist_t *)a->list, &key);
+        }
+        a->present[key] = !a->present[key];
+    }
+
+    return NULL;
+}
+
+/* 加锁链表队列: 偶数号线程入队, 奇数号线程出队(队列为空时让出处理器) */
+static void *__rwlock_queue_worker(void *arg)
+{
+    bench_arg_t *a = (bench_arg_t *)arg;
+    uolist_cursor_t it;
+    int temp = 0;
+    int i = 0;
+
+    pthread_barrier_wait(a->start);
+    for (i = 0; i < a->ops; i++)
+    {
+        if (a->id % 2 == 0)
+        {
+            uolist_append((uolist_t *)a->list, &i);
+            continue;
+        }
+        // 获取与删除须在同一把锁内完成
+        while (1)
+        {
+            uolist_lock_write((uolist_t *)a->list);
+            uolist_cursor_init(&it, (uolist_t *)a->list);
+            if (0 == uolist_cursor_get(&it, &temp))
+            {
+                uolist_cursor_erase(&it);
+                uolist_unlock((uolist_t *)a->list);
+                break;
+            }
+            uolist_unlock((uolist_t *)a->list);
+            sched_yield();
+        }
+    }
+
+    return NULL;
+}
+
+/* 无锁队列: 偶数号线程入队, 奇数号线程出队(队列为空时让出处理器) */
+static void *__lockfree_queue_worker(void *arg)
+{
+    bench_arg_t *a = (bench_arg_t *)arg;
+    int temp = 0;
+    int i = 0;
+
+    pthread_barrier_wait(a->start);
+    for (i = 0; i < a->ops; i++)
+    {
+        if (a->id % 2 == 0)
+        {
+            lfqueue_push((lfqueue_t *)a->list, &i);
+            continue;
+        }
+        while (0 != lfqueue_pop((lfqueue_t *)a->list, &temp))
+        {
+            sched_yield();
+        }
+    }
+
+    return NULL;
+}
+
+/* 以 n 个线程运行, 返回每秒操作数(百万); 计时不含线程的创建 */
+static double __run(void *list, void *(*worker)(void *), int n)
+{
+    pthread_t tid[BENCH_MAX_THREAD];
+    bench_arg_t arg[BENCH_MAX_THREAD];
+    pthread_barrier_t start;
+    struct timespec t0, t1;
+    int i = 0;
+    int k = 0;
+
+    pthread_barrier_init(&start, NULL, n + 1);
+    for (i = 0; i < n; i++)
+    {
+        arg[i].list = list;
+        arg[i].seed = 2463534242u + i * 7919;
+        arg[i].id = i;
+        arg[i].nthread = n;
+        arg[i].ops = BENCH_OPS;
+        arg[i].start = &start;
+        for (k = 0; k < BENCH_KEY_RANGE; k++)
+        {
+            arg[i].present[k] = (k % 2 == 0);
+        }
+        pthread_create(&tid[i], NULL, worker, &arg[i]);
+    }
+    pthread_barrier_wait(&start);
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (i = 0; i < n; i++)
+    {
+        pthread_join(tid[i], NULL);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    pthread_barrier_destroy(&start);
+
+    return (double)BENCH_OPS * n / ((t1.tv_sec - t0.tv_sec) * 1e6 + (t1.tv_nsec - t0.tv_nsec) / 1e3);
+}
+
+
+int main(int argc, char **argv)
+{
+    uolist_t *uo = NULL;
+    lflist_t *lf = NULL;
+    lflist_t *hp = NULL;
+    lfqueue_t *q = NULL;
+    int n = 0;
+    int i = 0;
+
+    printf("threads    rwlock(Mops/s)    epoch(Mops/s)    hazard(Mops/s)\n");
+    for (n = 1; n <= BENCH_MAX_THREAD; n *= 2)
+    {
+        // 各链表预先插入相同的数据
+        uo = uolist_create_ex(sizeof(int), NULL, UOLIST_INLINE | UOLIST_CONCURRENT);
+        uolist_set_order(uo, data_order);
+        lf = lflist_create_ex(sizeof(int), NULL, data_order, LFLIST_EPOCH);
+        hp = lflist_create_ex(sizeof(int), NULL, data_order, LFLIST_HAZARD);
+        for (i = 0; i < BENCH_KEY_RANGE; i += 2)
+        {
+            uolist_insert_sorted(uo, &i);
+            lflist_insert(lf, &i);
+            lflist_insert(hp, &i);
+        }
+
+        printf("%7d    %14.2f", n, __run(uo, __rwlock_worker, n));
+        printf("    %13.2f", __run(lf, __lockfree_worker, n));
+        printf("    %14.2f\n", __run(hp, __lockfree_worker, n));
+
+        uolist_destroy(uo);
+        head_destroy(&uo);
+        lflist_destroy(&lf);
+        lflist_destroy(&hp);
+    }
+
+    // 生产者与消费者各占一半线程
+    printf("\nthreads    rwlock queue(Mops/s)    lock-free queue(Mops/s)\n");
+    for (n = 2; n <= BENCH_MAX_THREAD; n *= 2)
+    {
+        uo = uolist_create_ex(sizeof(int), NULL, UOLIST_CONCURRENT);
+        q = lfqueue_create(sizeof(int), NULL);
+
+        printf("%7d    %20.2f", n, __run(uo, __rwlock_queue_worker, n));
+        printf("    %23.2f\n", __run(q, __lockfree_queue_worker, n));
+
+        uolist_destroy(uo);
+        head_destroy(&uo);
+        lfqueue_destroy(&q);
+    }
+
+    return 0;
+}
@@ -8,13 +8,176 @@
  */
 
 #include "uni_oneway_linkedlist.h"
+#include "uolist_unrolled.h"
+#include "uolist_skiplist.h"
+#include "uolist_hash.h"
+#include "uolist_sort.h"
+#include "uolist_lock.h"
+
+/**
+ * @brief           从内存池中分配节点空间
+ * @param           链表头信息结构体指针
+ * @param           是否将空间清零
+ * @return          节点指针, 失败返回 NULL
+ */
+static node_t *__pool_alloc(uolist_t *uo, int zero)
+{
+    pool_t *pool = &uo->pool;
+    node_t *p = NULL;
+    void **chunk = NULL;
+    size_t chunk_size = 0;
+
+    /* 1.优先复用空闲节点 */
+    if (NULL != pool->free_list)
+    {
+        p = pool->free_list;
+        pool->free_list = p->next;
+        if (zero)
+        {
+            memset(p, 0, pool->block_size);
+        } /* end of if (zero) */
+        return p;
+    } /* end of if (NULL != pool->free_list) */
+
+    /* 2.当前大块用尽时申请新的大块 */
+    if (pool->cur + pool->block_size > pool->end)
+    {
+        chunk_size = POOL_CHUNK_SIZE;
+        if (chunk_size < pool->block_size + sizeof(node_t))
+        {
+            chunk_size = pool->block_size + sizeof(node_t);
+        } /* end of if (chunk_size < pool->block_size + sizeof(node_t)) */
+
+        chunk = (void **)calloc(1, chunk_size);
+        if (NULL == chunk)
+        {
+        #ifdef DEBUG
+            printf("__pool_alloc: chunk calloc error\n");
+        #elif defined FILE_DEBUG
+            
+        #endif
+            return NULL;
+        } /* end of if (NULL == chunk) */
+
+        // 大块头部保存上一个大块的地址, 节点从对齐后的位置开始
+        *chunk = pool->chunks;
+        pool->chunks = chunk;
+        pool->cur = (char *)chunk + sizeof(node_t);
+        pool->end = (char *)chunk + chunk_size;
+    } /* end of if (pool->cur + pool->block_size > pool->end) */
+
+    /* 3.从当前大块中切分 */
+    p = (node_t *)pool->cur;
+    pool->cur += pool->block_size;
+
+    return p;
+}
+
+
+/**
+ * @brief           从内存池中一次分配连续的多个节点空间
+ * @details         当前大块剩余空间不足时单独申请一个恰好容纳全部节点的大块,
+ *                  空间不清零
+ * @param           链表头信息结构体指针
+ * @param           节点个数
+ * @return          第一个节点块的地址, 失败返回 NULL
+ */
+static char *__pool_alloc_bulk(uolist_t *uo, int n)
+{
+    pool_t *pool = &uo->pool;
+    size_t need = (size_t)n * pool->block_size;
+    void **chunk = NULL;
+    char *p = NULL;
+
+    /* 1.当前大块足够时直接切分 */
+    if (NULL != pool->cur && pool->cur + need <= pool->end)
+    {
+        p = pool->cur;
+        pool->cur += need;
+        return p;
+    } /* end of if (NULL != pool->cur && pool->cur + need <= pool->end) */
+
+    /* 2.申请专用大块(不影响当前大块的切分位置) */
+    chunk = (void **)malloc(sizeof(node_t) + need);
+    if (NULL == chunk)
+    {
+    #ifdef DEBUG
+        printf("__pool_alloc_bulk: chunk malloc error\n");
+    #elif defined FILE_DEBUG
+        
+    #endif
+        return NULL;
+    } /* end of if (NULL == chunk) */
+
+    *chunk = pool->chunks;
+    pool->chunks = chunk;
+
+    return (char *)chunk + sizeof(node_t);
+}
+
+
+/**
+ * @brief           释放内存池的全部空间
+ * @param           链表头信息结构体指针
+ * @return          无
+ */
+static void __pool_release(uolist_t *uo)
+{
+    void *chunk = uo->pool.chunks;
+    void *save = NULL;
+
+    while (NULL != chunk)
+    {
+        save = *(void **)chunk;
+        free(chunk);
+        chunk = save;
+    } /* end of while (NULL != chunk) */
+
+    uo->pool.chunks = NULL;
+    uo->pool.free_list = NULL;
+    uo->pool.cur = NULL;
+    uo->pool.end = NULL;
+}
+
+
+/**
+ * @brief           将源链表内存池的全部大块移交给目标链表
+ * @details         源链表的空闲节点及当前大块的剩余空间不再复用,
+ *                  随目标链表的内存池一起释放
+ * @param           目标链表头信息结构体指针
+ * @param           源链表头信息结构体指针
+ * @return          无
+ */
+static void __pool_merge(uolist_t *dst, uolist_t *src)
+{
+    void **chunk = (void **)src->pool.chunks;
+
+    if (NULL == chunk)
+    {
+        return;
+    } /* end of if (NULL == chunk) */
+
+    while (NULL != *chunk)
+    {
+        chunk = (void **)*chunk;
+    } /* end of while (NULL != *chunk) */
+    *chunk = dst->pool.chunks;
+    dst->pool.chunks = src->pool.chunks;
+
+    src->pool.chunks = NULL;
+    src->pool.free_list = NULL;
+    src->pool.cur = NULL;
+    src->pool.end = NULL;
+}
+
 
 /**
  * @brief           创建节点空间
  * @param           链表头信息结构体指针
+ * @param           是否将数据空间清零(原地构造数据时无需清零)
  * @return          节点指针
  */
-static node_t *__node_calloc(uolist_t *uo)
+static node_t *__node_alloc(uolist_t *uo, int zero)
 {
     /* 变量定义 */
     node_t *p = NULL;
@@ -23,19 +186,50 @@ static node_t *__node_calloc(uolist_t *uo)
     if (NULL == uo)
     {
     #ifdef DEBUG
-        printf("__node_calloc: Parameter error\n");
+        printf("__node_alloc: Parameter error\n");
     #elif defined FILE_DEBUG
         
     #endif
         goto ERR0;  
     } /* end of if (NULL == uo) */
 
+    /* 内存池模式: 节点与数据从内存池中一次分配 */
+    if (uo->flags & UOLIST_POOL)
+    {
+        p = __pool_alloc(uo, zero);
+        if (NULL == p)
+        {
+            goto ERR1;
+        } /* end of if (NULL == p) */
+
+        p->data = p->payload;
+        return p;
+    } /* end of if (uo->flags & UOLIST_POOL) */
+
+    /* 内联模式: 节点与数据一次申请 */
+    if (uo->flags & UOLIST_INLINE)
+    {
+        p = (node_t *)(zero ? calloc(1, sizeof(node_t) + uo->size) : malloc(sizeof(node_t) + uo->size));
+        if (NULL == p)
+        {
+        #ifdef DEBUG
+            printf("__node_alloc: p calloc error\n");
+        #elif defined FILE_DEBUG
+            
+        #endif
+            goto ERR1;  
+        } /* end of if (NULL == p) */
+
+        p->data = p->payload;
+        return p;
+    } /* end of if (uo->flags & UOLIST_INLINE) */
+
     /* 创建节点空间 */ 
     p = (node_t *)calloc(1, sizeof(node_t));
     if (NULL == p)
     {
     #ifdef DEBUG
-        printf("__node_calloc: p calloc error\n");
+        printf("__node_alloc: p calloc error\n");
     #elif defined FILE_DEBUG
         
     #endif
@@ -43,11 +237,11 @@ static node_t *__node_calloc(uolist_t *uo)
     } /* end of if (NULL == p) */
 
     /* 创建节点中数据空间 */
-    p->data = (void *)calloc(1, uo->size);
+    p->data = zero ? calloc(1, uo->size) : malloc(uo->size);
     if (NULL == p->data)
     {
     #ifdef DEBUG
-        printf("__node_calloc: data calloc error\n");
+        printf("__node_alloc: data calloc error\n");
     #elif defined FILE_DEBUG
         
     #endif
@@ -66,6 +260,352 @@ ERR1:
 }
 
 
+/**
+ * @brief           释放节点空间
+ * @param           链表头信息结构体指针
+ * @param           节点指针
+ * @return          无
+ */
+static void __node_free(uolist_t *uo, node_t *p)
+{
+    /* 1.删除哈希索引表项并释放数据空间 */
+    hindex_remove(uo, p);
+    if (NULL != uo->my_destroy)
+    {
+        uo->my_destroy(p->data);
+    }
+    else if (!(uo->flags & UOLIST_INLINE))
+    {
+        free(p->data);
+    }
+    p->data = NULL;
+
+    /* 2.释放节点空间(内存池模式下回收到空闲链表) */
+    if (uo->flags & UOLIST_POOL)
+    {
+        p->next = uo->pool.free_list;
+        uo->pool.free_list = p;
+        return;
+    } /* end of if (uo->flags & UOLIST_POOL) */
+
+    free(p);
+}
+
+
+/**
+ * @brief           判断节点申请是否失败
+ * @param           节点指针
+ * @return          1:失败 0:成功
+ */
+static int __node_invalid(node_t *p)
+{
+    return (void *)PAR_ERROR == p || (void *)FUN_ERROR == p;
+}
+
+
+/**
+ * @brief           由连续数组批量创建已连接好的节点链
+ * @details         内存池模式下全部节点一次分配, 其余模式逐个创建节点
+ * @param           链表头信息结构体指针
+ * @param           连续存放的 n 个数据
+ * @param           数据个数
+ * @param           保存节点链第一个节点的指针
+ * @param           保存节点链最后一个节点的指针
+ * @return          
+ *      @arg  0:正常
+ *      @arg  FUN_ERROR:函数错误
+ */
+static int __chain_build(uolist_t *uo, void *data, int n, node_t **first, node_t **last)
+{
+    node_t head = {0};
+    node_t *tail = &head;
+    node_t *p = NULL;
+    char *block = NULL;
+    char *src = (char *)data;
+    int i = 0;
+
+    /* 内存池模式: 一次分配全部节点, 紧凑循环中连接 */
+    if (uo->flags & UOLIST_POOL)
+    {
+        block = __pool_alloc_bulk(uo, n);
+        if (NULL == block)
+        {
+            goto ERR1;
+        } /* end of if (NULL == block) */
+
+        for (i = 0; i < n; i++, block += uo->pool.block_size, src += uo->size)
+        {
+            p = (node_t *)block;
+            p->data = p->payload;
+            memcpy(p->data, src, uo->size);
+            tail->next = p;
+            tail = p;
+        } /* end of for (i = 0; i < n; i++, block += uo->pool.block_size, src += uo->size) */
+    }
+    else 
+    {
+        for (i = 0; i < n; i++, src += uo->size)
+        {
+            p = __node_alloc(uo, 0);
+            if (__node_invalid(p))
+            {
+                goto ERR2;
+            } /* end of if (__node_invalid(p)) */
+
+            memcpy(p->data, src, uo->size);
+            tail->next = p;
+            tail = p;
+        } /* end of for (i = 0; i < n; i++, src += uo->size) */
+    }
+
+    tail->next = NULL;
+    *first = head.next;
+    *last = tail;
+
+    return 0;
+
+ERR2:
+    // 释放已创建的节点(此时数据尚未交给链表, 不调用自定义销毁函数)
+    tail->next = NULL;
+    for (p = head.next; NULL != p; p = head.next)
+    {
+        head.next = p->next;
+        if (!(uo->flags & UOLIST_INLINE))
+        {
+            free(p->data);
+        } /* end of if (!(uo->flags & UOLIST_INLINE)) */
+        free(p);
+    } /* end of for (p = head.next; NULL != p; p = head.next) */
+ERR1:
+    return FUN_ERROR;
+}
+
+
+/**
+ * @brief           将节点插入到指定前驱之后, 同时刷新头尾指针及节点个数
+ * @param           链表头信息结构体指针
+ * @param           前驱节点(插入到链表头部时为 NULL)
+ * @param           要插入的节点
+ * @return          无
+ */
+static void __node_link(uolist_t *uo, node_t *prev, node_t *p)
+{
+    /* 1.连接节点 */
+    if (NULL == prev)
+    {
+        p->next = uo->fstnode_p;
+        uo->fstnode_p = p;
+    }
+    else 
+    {
+        p->next = prev->next;
+        prev->next = p;
+    }
+    if (uo->lstnode_p == prev)
+    {
+        uo->lstnode_p = p;
+    } /* end of if (uo->lstnode_p == prev) */
+
+    /* 2.刷新信息, 跳表索引随之失效 */
+    uo->count++;
+    uo->skdirty = 1;
+    hindex_insert(uo, p);
+}
+
+
+/**
+ * @brief           摘除并释放节点, 同时刷新头尾指针及节点个数
+ * @param           链表头信息结构体指针
+ * @param           要删除节点的前驱(删除第一个节点时为 NULL)
+ * @param           要删除的节点
+ * @return          无
+ */
+static void __node_unlink(uolist_t *uo, node_t *prev, node_t *des)
+{
+    /* 1.连接节点 */
+    if (NULL == prev)
+    {
+        uo->fstnode_p = des->next;
+    }
+    else 
+    {
+        prev->next = des->next;
+    }
+    if (uo->lstnode_p == des)
+    {
+        uo->lstnode_p = prev;
+    } /* end of if (uo->lstnode_p == des) */
+
+    /* 2.释放节点 */
+    __node_free(uo, des);
+
+    /* 3.刷新信息, 跳表索引随之失效 */
+    uo->count--;
+    uo->skdirty = 1;
+}
+
+
+/**
+ * @brief           根据索引获取节点
+ * @param           链表头信息结构体指针
+ * @param           索引值(调用者保证 0 <= index < count)
+ * @return          索引位置的节点
+ */
+static node_t *__node_at(uolist_t *uo, int index)
+{
+    node_t *temp = uo->fstnode_p;
+    int i = 0;
+
+    /* 尾节点直接返回 */
+    if (index == uo->count - 1)
+    {
+        return uo->lstnode_p;
+    } /* end of if (index == uo->count - 1) */
+
+    /* 跳表模式按索引逐层下降 */
+    if (uo->flags & UOLIST_SKIPLIST)
+    {
+        skiplist_sync(uo);
+        return skiplist_at(uo, index);
+    } /* end of if (uo->flags & UOLIST_SKIPLIST) */
+
+    for (i = 0; i < index; i++)
+    {
+        temp = temp->next;
+    } /* end of for (i = 0; i < index; i++) */
+
+    return temp;
+}
+
+
+/**
+ * @brief           获取插入索引位置的前驱节点
+ * @param           链表头信息结构体指针
+ * @param           插入索引(大于等于节点个数时插入到尾部)
+ * @return          前驱节点, 插入到头部时为 NULL
+ */
+static node_t *__insert_prev(uolist_t *uo, int index)
+{
+    if (index <= 0)
+    {
+        return NULL;
+    } /* end of if (index <= 0) */
+
+    if (index >= uo->count)
+    {
+        return uo->lstnode_p;
+    } /* end of if (index >= uo->count) */
+
+    return __node_at(uo, index - 1);
+}
+
+
+/**
+ * @brief           将节点插入到索引位置, 跳表模式下同步维护索引
+ * @param           链表头信息结构体指针
+ * @param           插入索引(大于等于节点个数时插入到尾部)
+ * @param           要插入的节点
+ * @return          无
+ */
+static void __node_link_at(uolist_t *uo, int index, node_t *p)
+{
+    if (uo->flags & UOLIST_SKIPLIST)
+    {
+        // 头尾插入不需要定位, 索引已失效时不急于重建
+        if (index > 0 && index < uo->count)
+        {
+            skiplist_sync(uo);
+        } /* end of if (index > 0 && index < uo->count) */
+        if (!uo->skdirty)
+        {
+            skiplist_link(uo, index, p);
+            hindex_insert(uo, p);
+            return;
+        } /* end of if (!uo->skdirty) */
+    } /* end of if (uo->flags & UOLIST_SKIPLIST) */
+
+    __node_link(uo, __insert_prev(uo, index), p);
+}
+
+
+/**
+ * @brief           根据关键字查找匹配节点
+ * @param           链表头信息结构体指针
+ * @param           关键字
+ * @param           自定义比较函数
+ * @param           保存匹配节点前驱的指针(匹配第一个节点时为 NULL), 可为 NULL
+ * @return          匹配节点, 无匹配时返回 NULL
+ */
+static node_t *__node_find(uolist_t *uo, void *key, cmp_t op_cmp, node_t **prev)
+{
+    node_t *p = NULL;
+    node_t *temp = NULL;
+
+    /* 优先通过哈希索引查找 */
+    if (0 == hindex_find(uo, key, op_cmp, &temp, prev, NULL))
+    {
+        return temp;
+    } /* end of if (0 == hindex_find(uo, key, op_cmp, &temp, prev, NULL)) */
+
+    for (temp = uo->fstnode_p; NULL != temp; p = temp, temp = temp->next)
+    {
+        if (MATCH_SUCCESS == op_cmp(temp->data, key))
+        {
+            break;
+        } /* end of if (MATCH_SUCCESS == op_cmp(temp->data, key)) */
+    } /* end of for (temp = uo->fstnode_p; NULL != temp; p = temp, temp = temp->next) */
+
+    if (NULL != prev)
+    {
+        *prev = p;
+    } /* end of if (NULL != prev) */
+
+    return temp;
+}
+
+
+
+/**
+ * @brief           有序模式下定位第一个大于(或不小于)关键字的节点
+ * @details         遇到更大的数据即停止; 跳表模式下先经索引下降
+ * @param           链表头信息结构体指针
+ * @param           关键字
+ * @param           为 0 时定位第一个不小于关键字的节点, 否则定位第一个大于关键字的节点
+ * @param           保存所定位节点前驱的指针(定位到第一个节点时为 NULL)
+ * @param           保存所定位节点索引的指针
+ * @return          所定位的节点, 不存在时返回 NULL(索引为 count)
+ */
+static node_t *__node_seek(uolist_t *uo, void *key, int upper, node_t **prev, int *index)
+{
+    sknode_t *x = NULL;
+    node_t *p = NULL;
+    node_t *temp = uo->fstnode_p;
+    int i = 0;
+
+    /* 跳表模式: 从索引下降到的位置继续 */
+    if (uo->flags & UOLIST_SKIPLIST)
+    {
+        skiplist_sync(uo);
+        x = skiplist_seek(uo, key, uo->my_order, upper, &i);
+        if (x != uo->skhead)
+        {
+            p = x->node;
+            temp = p->next;
+        } /* end of if (x != uo->skhead) */
+    } /* end of if (uo->flags & UOLIST_SKIPLIST) */
+
+    for (; NULL != temp && uo->my_order(temp->data, key) < upper; p = temp, temp = temp->next)
+    {
+        i++;
+    } /* end of for (; NULL != temp && uo->my_order(temp->data, key) < upper; p = temp, temp = temp->next) */
+
+    *prev = p;
+    *index = i;
+
+    return temp;
+}
+
+
 
 /**
  * @brief           创建链表头信息结构体
@@ -74,6 +614,20 @@ ERR1:
  * @return          指向链表头信息结构体的指针
  */
 uolist_t *uolist_create(int size, op_t my_destroy)
+{
+    return uolist_create_ex(size, my_destroy, UOLIST_DEFAULT);
+}
+
+
+/**
+ * @brief           按指定存储模式创建链表头信息结构体
+ * @param           存储数据类型大小
+ * @param           自定义销毁数据函数
+ * @param           存储模式(UOLIST_DEFAULT / UOLIST_INLINE / UOLIST_POOL / UOLIST_ARENA /
+ *                  UOLIST_UNROLLED / UOLIST_SKIPLIST / UOLIST_CONCURRENT)
+ * @return          指向链表头信息结构体的指针
+ */
+uolist_t *uolist_create_ex(int size, op_t my_destroy, int flags)
 {
     /* 变量定义 */
     uolist_t *uo = NULL;
@@ -82,7 +636,7 @@ uolist_t *uolist_create(int size, op_t my_destroy)
     if (size <= 0)
     {
     #ifdef DEBUG
-        printf("uolist_create: Parameter error\n");
+        printf("uolist_create_ex: Parameter error\n");
     #elif defined FILE_DEBUG
         
     #endif
@@ -95,7 +649,7 @@ uolist_t *uolist_create(int size, op_t my_destroy)
     if (NULL == uo)
     {
     #ifdef DEBUG
-        printf("uolist_create: calloc error\n");
+        printf("uolist_create_ex: calloc error\n");
     #elif defined FILE_DEBUG
         
     #endif
@@ -105,7 +659,35 @@ uolist_t *uolist_create(int size, op_t my_destroy)
     /* 信息输入 */
     uo->count = 0;
     uo->size = size;
+    uo->flags = flags;
+    if (uo->flags & UOLIST_UNROLLED)
+    {
+        // 展开链表与其他存储模式互斥
+        uo->flags = UOLIST_UNROLLED | (flags & UOLIST_CONCURRENT);
+    } /* end of if (uo->flags & UOLIST_UNROLLED) */
+    if (uo->flags & UOLIST_ARENA)
+    {
+        uo->flags |= UOLIST_POOL;
+    } /* end of if (uo->flags & UOLIST_ARENA) */
+    if (uo->flags & UOLIST_POOL)
+    {
+        // 节点块大小按节点结构体大小对齐, 保证数据域对齐
+        uo->flags |= UOLIST_INLINE;
+        uo->pool.block_size = (sizeof(node_t) + size + sizeof(node_t) - 1) / sizeof(node_t) * sizeof(node_t);
+    } /* end of if (uo->flags & UOLIST_POOL) */
+    if ((uo->flags & UOLIST_SKIPLIST) && 0 != skiplist_init(uo))
+    {
+        free(uo);
+        goto ERR1;
+    } /* end of if ((uo->flags & UOLIST_SKIPLIST) && 0 != skiplist_init(uo)) */
+    if ((uo->flags & UOLIST_CONCURRENT) && 0 != lock_init(uo))
+    {
+        skiplist_release(uo);
+        free(uo);
+        goto ERR1;
+    } /* end of if ((uo->flags & UOLIST_CONCURRENT) && 0 != lock_init(uo)) */
     uo->fstnode_p = NULL;
+    uo->lstnode_p = NULL;
     uo->my_destroy = my_destroy;
 
 
@@ -127,10 +709,10 @@ ERR1:
  *      @arg  PAR_ERROR:参数错误
  *      @arg  FUN_ERROR:函数错误
  */
-int uolist_prepend(uolist_t *uo, void *data)
+static int __uolist_prepend(uolist_t *uo, void *data)
 {
+    void *elem = NULL;
     node_t *temp1 = NULL;
-    node_t *temp2 = NULL;
 
     /* 参数检查 */
     if (NULL == uo || NULL == data)
@@ -143,28 +725,31 @@ int uolist_prepend(uolist_t *uo, void *data)
         goto ERR0;        
     } /* end of if (NULL == uo || NULL == data) */
 
+    /* 展开链表模式 */
+    if (uo->flags & UOLIST_UNROLLED)
+    {
+        elem = unrolled_insert(uo, 0);
+        if (NULL == elem)
+        {
+            goto ERR1;
+        } /* end of if (NULL == elem) */
+        memcpy(elem, data, uo->size);
+        return 0;
+    } /* end of if (uo->flags & UOLIST_UNROLLED) */
+
     /* 1.创建一个新的节点 */
-    temp1 = __node_calloc(uo);
+    temp1 = __node_alloc(uo, 1);
+    if (__node_invalid(temp1))
+    {
+        goto ERR1;
+    } /* end of if (__node_invalid(temp1)) */
 
     /* 2.节点数据输入 */
-    temp1->next = NULL;
     memcpy(temp1->data, data, uo->size);
 
 
     /* 3.链表节点头部插入 */
-    if (NULL == uo->fstnode_p)
-    {
-        uo->fstnode_p = temp1;
-    }
-    else 
-    {
-        temp2 = uo->fstnode_p;
-        uo->fstnode_p = temp1;
-        temp1->next = temp2;
-    }
-
-    /* 链表头信息更新 */
-    uo->count++;
+    __node_link_at(uo, 0, temp1);
 
     return 0;
 
@@ -183,7 +768,7 @@ ERR1:
  *      @arg  PAR_ERROR:参数错误
  *      @arg  FUN_ERROR:函数错误
  */
-int uolist_traverse(uolist_t *uo, op_t my_print)
+static int __uolist_traverse(uolist_t *uo, op_t my_print)
 {
     node_t *temp = NULL;
 
@@ -198,6 +783,12 @@ int uolist_traverse(uolist_t *uo, op_t my_print)
         goto ERR0;        
     } /* end of if (NULL == uo || NULL == my_print) */
 
+    /* 展开链表模式 */
+    if (uo->flags & UOLIST_UNROLLED)
+    {
+        return unrolled_traverse(uo, my_print);
+    } /* end of if (uo->flags & UOLIST_UNROLLED) */
+
 
 
     /* 链表的遍历 */
@@ -227,7 +818,7 @@ ERR1:
  *      @arg  PAR_ERROR:参数错误
  *      @arg  FUN_ERROR:函数错误
  */
-int uolist_destroy(uolist_t *uo)
+static int __uolist_destroy(uolist_t *uo)
 {
     node_t *temp = NULL;
     node_t *save = NULL;
@@ -243,29 +834,48 @@ int uolist_destroy(uolist_t *uo)
         goto ERR0;        
     } /* end of if (NULL == uo) */    
 
+    /* 展开链表模式 */
+    if (uo->flags & UOLIST_UNROLLED)
+    {
+        return unrolled_destroy(uo);
+    } /* end of if (uo->flags & UOLIST_UNROLLED) */
+
     temp = uo->fstnode_p;
 
+    /* 哈希索引表项整体释放 */
+    hindex_clear(uo);
+
+    /* 区域模式: 只调用自定义销毁函数, 节点空间随内存池整体释放 */
+    if (uo->flags & UOLIST_ARENA)
+    {
+        for (; NULL != uo->my_destroy && NULL != temp; temp = temp->next)
+        {
+            uo->my_destroy(temp->data);
+        } /* end of for (; NULL != uo->my_destroy && NULL != temp; temp = temp->next) */
+
+        __pool_release(uo);
+        temp = NULL;
+    } /* end of if (uo->flags & UOLIST_ARENA) */
+
     /* 依次释放节点空间 */
     while (NULL != temp)
     {
         /* 1.保存下个节点的指针 */
         save = temp->next;
 
-        /* 2.释放数据空间 */
-        uo->my_destroy(temp->data);
-        temp->data = NULL;
-
-        /* 3.释放节点空间 */
-        free(temp);
+        /* 2.释放数据及节点空间 */
+        __node_free(uo, temp);
         temp = NULL;
 
-        /* 4.指向下一个节点 */
+        /* 3.指向下一个节点 */
         temp = save;
     } /* end of while (NULL != temp) */
 
     /* 头信息刷新 */
     uo->fstnode_p = NULL;
+    uo->lstnode_p = NULL;
     uo->count = 0;
+    uo->skdirty = 1;
 
     return 0;
 
@@ -298,6 +908,15 @@ int head_destroy(uolist_t **p)
         goto ERR0;        
     } /* end of if (NULL == p) */  
 
+    /* 释放内存池及索引空间 */
+    if (NULL != *p)
+    {
+        __pool_release(*p);
+        skiplist_release(*p);
+        hindex_release(*p);
+        lock_release(*p);
+    } /* end of if (NULL != *p) */
+
     /* 销毁结构体空间 */
     free(*p);
     *p = NULL;
@@ -316,7 +935,7 @@ ERR1:
  * @param           头信息结构体的指针
  * @return          链表节点个数
  */
-int get_count(uolist_t *p)
+static int __get_count(uolist_t *p)
 {
 
     /* 参数检查 */
@@ -345,10 +964,10 @@ ERR0:
  *      @arg  PAR_ERROR:参数错误
  *      @arg  FUN_ERROR:函数错误
  */
-int uolist_append(uolist_t *uo, void *data)
+static int __uolist_append(uolist_t *uo, void *data)
 {
+    void *elem = NULL;
     node_t *temp1 = NULL;
-    node_t *temp2 = NULL;
 
     /* 参数检查 */
     if (NULL == uo || NULL == data)
@@ -361,31 +980,30 @@ int uolist_append(uolist_t *uo, void *data)
         goto ERR0;        
     } /* end of if (NULL == uo || NULL == data) */
 
+    /* 展开链表模式 */
+    if (uo->flags & UOLIST_UNROLLED)
+    {
+        elem = unrolled_insert(uo, uo->count);
+        if (NULL == elem)
+        {
+            goto ERR1;
+        } /* end of if (NULL == elem) */
+        memcpy(elem, data, uo->size);
+        return 0;
+    } /* end of if (uo->flags & UOLIST_UNROLLED) */
+
     /* 1.创建一个新的节点 */
-    temp1 = __node_calloc(uo);
+    temp1 = __node_alloc(uo, 1);
+    if (__node_invalid(temp1))
+    {
+        goto ERR1;
+    } /* end of if (__node_invalid(temp1)) */
 
     /* 2.节点数据输入 */
-    temp1->next = NULL;
     memcpy(temp1->data, data, uo->size);
 
-    /* 3.数据尾部插入 */
-    if (NULL == uo->fstnode_p)
-    {
-        uo->fstnode_p = temp1;
-    }
-    else 
-    {
-        temp2 = uo->fstnode_p;
-        while (temp2->next != NULL)
-        {
-            temp2 = temp2->next;
-        } /* end of while (temp2->next != NULL) */
-
-        temp2->next = temp1;
-    }
-
-    /* 4.刷新信息 */
-    uo->count++;
+    /* 3.数据尾部插入(尾指针直接定位, 无需遍历) */
+    __node_link_at(uo, uo->count, temp1);
 
     return 0;
 
@@ -406,12 +1024,10 @@ ERR1:
  *      @arg  PAR_ERROR:参数错误
  *      @arg  FUN_ERROR:函数错误
  */
-int uolist_insert_by_index(uolist_t *uo, void *data, int index)
+static int __uolist_insert_by_index(uolist_t *uo, void *data, int index)
 {
+    void *elem = NULL;
     node_t *temp1 = NULL;
-    node_t *temp2 = NULL;
-    node_t *save = NULL;
-    int i = 0;
 
 
     /* 参数检查 */
@@ -425,51 +1041,30 @@ int uolist_insert_by_index(uolist_t *uo, void *data, int index)
         goto ERR0;        
     } /* end of if (NULL == uo || NULL == data || index < 0) */
 
-    /* 1.创建一个新的节点 */
-    temp1 = __node_calloc(uo);
-
-    /* 2.节点数据输入 */
-    temp1->next = NULL;
-    memcpy(temp1->data, data, uo->size);
-
-    /* 3.判断索引 */
-    temp2 = uo->fstnode_p;
-    if (index < uo->count && index > 0)
+    /* 展开链表模式 */
+    if (uo->flags & UOLIST_UNROLLED)
     {
-        // 寻找索引位置
-        for (i = 0; i < index - 1; i++)
+        elem = unrolled_insert(uo, index);
+        if (NULL == elem)
         {
-            temp2 = temp2->next;
-        } /* end of for (i = 0; i < index; i++) */
-
-        // 保存索引位置的链表
-        save = temp2->next;
-
-        // 在索引位置插入新节点
-        temp2->next = temp1;
+            goto ERR1;
+        } /* end of if (NULL == elem) */
+        memcpy(elem, data, uo->size);
+        return 0;
+    } /* end of if (uo->flags & UOLIST_UNROLLED) */
 
-        // 链接保存链表
-        temp1->next = save;
-    }
-    else if (index == 0)
-    {
-        // 头部插入
-        uo->fstnode_p = temp1;
-        temp1->next = temp2;
-    }
-    else 
+    /* 1.创建一个新的节点 */
+    temp1 = __node_alloc(uo, 1);
+    if (__node_invalid(temp1))
     {
-        // 尾部插入
-        while (temp2->next != NULL)
-        {
-            temp2 = temp2->next;
-        } /* end of while (temp2->next != NULL) */
+        goto ERR1;
+    } /* end of if (__node_invalid(temp1)) */
 
-        temp2->next = temp1;
-    }
+    /* 2.节点数据输入 */
+    memcpy(temp1->data, data, uo->size);
 
-    /* 刷新管理信息 */
-    uo->count++;
+    /* 3.在索引位置插入(索引大于等于节点个数时尾部插入) */
+    __node_link_at(uo, index, temp1);
 
     return 0;
 
@@ -492,10 +1087,9 @@ ERR1:
  *      @arg  PAR_ERROR:参数错误
  *      @arg  FUN_ERROR:函数错误
  */
-int uolist_delete_by_index(uolist_t *uo, int index)
+static int __uolist_delete_by_index(uolist_t *uo, int index)
 {
     node_t *temp1 = NULL;
-    node_t *temp2 = NULL;
     node_t *des = NULL;
     int i = 0;
 
@@ -511,45 +1105,32 @@ int uolist_delete_by_index(uolist_t *uo, int index)
         goto ERR0;        
     } /* end of if (NULL == uo || index < 0 || index >= uo->count) */
 
-    /* 寻找索引的前一个 */
-    if (index == 0)
+    /* 展开链表模式 */
+    if (uo->flags & UOLIST_UNROLLED)
     {
-        // 保存节点
-        des = uo->fstnode_p;
-        temp2 = uo->fstnode_p->next;
-
-        // 连接节点
-        uo->fstnode_p = temp2;
+        return unrolled_delete(uo, index);
+    } /* end of if (uo->flags & UOLIST_UNROLLED) */
 
-        // 释放节点
-        uo->my_destroy(des->data);
-        free(des);
-        des = NULL;
-    }
-    else 
+    /* 跳表模式: 摘除节点时同步维护索引 */
+    if (uo->flags & UOLIST_SKIPLIST)
     {
-        // 寻找并保存节点
-        temp1 = uo->fstnode_p;
-        for (i = 0; i < index - 1; i++)
-        {
-            temp1 = temp1->next;
-        } /* end of for (i = 0; i < index - 1; i++) */
-
-        temp2 = temp1->next->next;
-        des = temp1->next;
-
-        // 连接节点
-        temp1->next = temp2;
-
-        // 释放节点
-        uo->my_destroy(des->data);
-        free(des);
-        des = NULL;
-    }
+        skiplist_sync(uo);
+        __node_free(uo, skiplist_unlink(uo, index));
+        return 0;
+    } /* end of if (uo->flags & UOLIST_SKIPLIST) */
 
+    /* 寻找索引的前一个 */
+    temp1 = NULL;
+    des = uo->fstnode_p;
+    for (i = 0; i < index; i++)
+    {
+        temp1 = des;
+        des = des->next;
+    } /* end of for (i = 0; i < index; i++) */
 
-    /* 刷新信息 */
-    uo->count--;
+    /* 摘除并释放节点 */
+    __node_unlink(uo, temp1, des);
+    des = NULL;
 
     return 0;
 
@@ -572,9 +1153,8 @@ ERR1:
  *      @arg  PAR_ERROR:参数错误
  *      @arg  FUN_ERROR:函数错误
  */
-int uolist_modify_by_index(uolist_t *uo, void *data, int index)
+static int __uolist_modify_by_index(uolist_t *uo, void *data, int index)
 {
-    int i = 0;
     node_t *temp = NULL;
 
 
@@ -589,15 +1169,20 @@ int uolist_modify_by_index(uolist_t *uo, void *data, int index)
         goto ERR0;        
     } /* end of if (NULL == uo || index < 0 || index >= uo->count || NULL == data) */
 
-    /* 寻找索引位置 */
-    temp = uo->fstnode_p;
-    for (i = 0; i < index; i++)
+    /* 展开链表模式 */
+    if (uo->flags & UOLIST_UNROLLED)
     {
-        temp = temp->next;
-    } /* end of for (i = 0; i < index; i++) */
+        memcpy(unrolled_at(uo, index), data, uo->size);
+        return 0;
+    } /* end of if (uo->flags & UOLIST_UNROLLED) */
+
+    /* 寻找索引位置 */
+    temp = __node_at(uo, index);
 
-    /* 修改数据 */
+    /* 修改数据, 同时刷新哈希索引表项 */
+    hindex_remove(uo, temp);
     memcpy(temp->data, data, uo->size);
+    hindex_insert(uo, temp);
 
     return 0;
 
@@ -619,9 +1204,8 @@ ERR1:
  *      @arg  PAR_ERROR:参数错误
  *      @arg  FUN_ERROR:函数错误
  */
-int uolist_retrieve_by_index(uolist_t *uo, void *data, int index)
+static int __uolist_retrieve_by_index(uolist_t *uo, void *data, int index)
 {
-    int i = 0;
     node_t *temp = NULL;
 
     /* 参数检查 */
@@ -635,15 +1219,18 @@ int uolist_retrieve_by_index(uolist_t *uo, void *data, int index)
         goto ERR0;        
     } /* end of if (NULL == uo || index < 0 || index >= uo->count || NULL == data) */
 
+    /* 展开链表模式 */
+    if (uo->flags & UOLIST_UNROLLED)
+    {
+        memcpy(data, unrolled_at(uo, index), uo->size);
+        return 0;
+    } /* end of if (uo->flags & UOLIST_UNROLLED) */
+
 
     /* 寻找索引位置 */
-    temp = uo->fstnode_p;
-    for (i = 0; i < index; i++)
-    {
-        temp = temp->next;
-    } /* end of for (i = 0; i < index; i++) */
+    temp = __node_at(uo, index);
 
-    /* 修改数据 */
+    /* 获取数据 */
     memcpy(data, temp->data, uo->size);
 
 
@@ -666,7 +1253,7 @@ ERR1:
  *      @arg  PAR_ERROR:参数错误
  *      @arg  MATCH_FAIL:无匹配索引
  */
-int get_match_index(uolist_t *uo, void *key, cmp_t op_cmp)
+static int __get_match_index(uolist_t *uo, void *key, cmp_t op_cmp)
 {
     int index = 0;
     node_t *temp = NULL;
@@ -683,12 +1270,28 @@ int get_match_index(uolist_t *uo, void *key, cmp_t op_cmp)
         goto ERR0;        
     } /* end of if (NULL == uo || NULL == key || NULL == op_cmp) */
 
+    /* 展开链表模式 */
+    if (uo->flags & UOLIST_UNROLLED)
+    {
+        if (NULL == unrolled_find(uo, key, op_cmp, &index))
+        {
+            goto ERR1;
+        } /* end of if (NULL == unrolled_find(uo, key, op_cmp, &index)) */
+        return index;
+    } /* end of if (uo->flags & UOLIST_UNROLLED) */
+
 
     /* 判断是否为空链表 */
-    if (NULL == uo->fstnode_p)
+    if (0 == uo->count)
     {
         goto ERR1;
-    } /* end of if (NULL == uo->fstnode_p) */
+    } /* end of if (0 == uo->count) */
+
+    /* 哈希索引 */
+    if (0 == hindex_find(uo, key, op_cmp, &temp, NULL, &index))
+    {
+        return NULL == temp ? MATCH_FAIL : index;
+    } /* end of if (0 == hindex_find(uo, key, op_cmp, &temp, NULL, &index)) */
 
     /* 寻找匹配索引 */
     index = 0;
@@ -726,9 +1329,10 @@ ERR1:
  *      @arg  PAR_ERROR:参数错误
  *      @arg  FUN_ERROR:函数错误
  */
-int uolist_delete_by_key(uolist_t *uo, void *key, cmp_t op_cmp)
+static int __uolist_delete_by_key(uolist_t *uo, void *key, cmp_t op_cmp)
 {
-    int index = 0;
+    node_t *prev = NULL;
+    node_t *temp = NULL;
 
     /* 参数检查 */
     if (NULL == uo || NULL == key || NULL == op_cmp)
@@ -741,17 +1345,23 @@ int uolist_delete_by_key(uolist_t *uo, void *key, cmp_t op_cmp)
         goto ERR0;        
     } /* end of if (NULL == uo || NULL == key || NULL == op_cmp) */
 
+    /* 展开链表模式 */
+    if (uo->flags & UOLIST_UNROLLED)
+    {
+        return unrolled_delete_by_key(uo, key, op_cmp);
+    } /* end of if (uo->flags & UOLIST_UNROLLED) */
+
 
-    /* 获取匹配索引 */
-    index = get_match_index(uo, key, op_cmp);
-    if (PAR_ERROR == index || MATCH_FAIL == index)
+    /* 获取匹配节点及其前驱 */
+    temp = __node_find(uo, key, op_cmp, &prev);
+    if (NULL == temp)
     {
         goto ERR1;
-    } /* end of if (PAR_ERROR == index || MATCH_FAIL == index) */
+    } /* end of if (NULL == temp) */
 
 
-    /* 根据索引删除节点 */
-    uolist_delete_by_index(uo, index);
+    /* 直接摘除匹配节点 */
+    __node_unlink(uo, prev, temp);
 
 
     return 0;
@@ -774,9 +1384,10 @@ ERR1:
  *      @arg  PAR_ERROR:参数错误
  *      @arg  FUN_ERROR:函数错误
  */
-int uolist_modify_by_key(uolist_t *uo, void *data, void *key, cmp_t op_cmp)
+static int __uolist_modify_by_key(uolist_t *uo, void *data, void *key, cmp_t op_cmp)
 {
-    int index = 0;
+    void *elem = NULL;
+    node_t *temp = NULL;
 
     /* 参数检查 */
     if (NULL == uo || NULL == key || NULL == op_cmp || NULL == data)
@@ -789,17 +1400,31 @@ int uolist_modify_by_key(uolist_t *uo, void *data, void *key, cmp_t op_cmp)
         goto ERR0;        
     } /* end of if (NULL == uo || NULL == key || NULL == op_cmp || NULL == data) */
 
+    /* 展开链表模式 */
+    if (uo->flags & UOLIST_UNROLLED)
+    {
+        elem = unrolled_find(uo, key, op_cmp, NULL);
+        if (NULL == elem)
+        {
+            goto ERR1;
+        } /* end of if (NULL == elem) */
+        memcpy(elem, data, uo->size);
+        return 0;
+    } /* end of if (uo->flags & UOLIST_UNROLLED) */
+
 
-    /* 获取匹配索引 */
-    index = get_match_index(uo, key, op_cmp);
-    if (PAR_ERROR == index || MATCH_FAIL == index)
+    /* 获取匹配节点 */
+    temp = __node_find(uo, key, op_cmp, NULL);
+    if (NULL == temp)
     {
         goto ERR1;
-    } /* end of if (PAR_ERROR == index || MATCH_FAIL == index) */
+    } /* end of if (NULL == temp) */
 
 
-    /* 根据索引修改数据 */
-    uolist_modify_by_index(uo, data, index);
+    /* 直接修改匹配节点数据, 同时刷新哈希索引表项 */
+    hindex_remove(uo, temp);
+    memcpy(temp->data, data, uo->size);
+    hindex_insert(uo, temp);
 
 
     return 0;
@@ -822,9 +1447,10 @@ ERR1:
  *      @arg  PAR_ERROR:参数错误
  *      @arg  FUN_ERROR:函数错误
  */
-int uolist_retrieve_by_key(uolist_t *uo, void *data, void *key, cmp_t op_cmp)
+static int __uolist_retrieve_by_key(uolist_t *uo, void *data, void *key, cmp_t op_cmp)
 {
-    int index = 0;
+    void *elem = NULL;
+    node_t *temp = NULL;
 
     /* 参数检查 */
     if (NULL == uo || NULL == key || NULL == op_cmp || NULL == data)
@@ -837,16 +1463,28 @@ int uolist_retrieve_by_key(uolist_t *uo, void *data, void *key, cmp_t op_cmp)
         goto ERR0;        
     } /* end of if (NULL == uo || NULL == key || NULL == op_cmp || NULL == data) */
 
+    /* 展开链表模式 */
+    if (uo->flags & UOLIST_UNROLLED)
+    {
+        elem = unrolled_find(uo, key, op_cmp, NULL);
+        if (NULL == elem)
+        {
+            goto ERR1;
+        } /* end of if (NULL == elem) */
+        memcpy(data, elem, uo->size);
+        return 0;
+    } /* end of if (uo->flags & UOLIST_UNROLLED) */
+
 
-    /* 获取匹配索引 */
-    index = get_match_index(uo, key, op_cmp);
-    if (PAR_ERROR == index || MATCH_FAIL == index)
+    /* 获取匹配节点 */
+    temp = __node_find(uo, key, op_cmp, NULL);
+    if (NULL == temp)
     {
         goto ERR1;
-    } /* end of if (PAR_ERROR == index || MATCH_FAIL == index) */
+    } /* end of if (NULL == temp) */
 
-    /* 根据索引获取数据 */
-    uolist_retrieve_by_index(uo, data, index);
+    /* 直接获取匹配节点数据 */
+    memcpy(data, temp->data, uo->size);
 
     return 0;
 
@@ -860,18 +1498,19 @@ ERR1:
 
 
 /**
- * @brief           链表根据关键字删除所有匹配的节点
+ * @brief           链表根据关键字删除所有匹配的节点(单次遍历)
  * @param           头信息结构体的指针
  * @param           关键字
  * @param           自定义比较函数 
- * @return          
- *      @arg  0:正常
+ * @return          删除的节点个数
  *      @arg  PAR_ERROR:参数错误
- *      @arg  FUN_ERROR:函数错误
  */
-int uolist_delete_all_by_key(uolist_t *uo, void *key, cmp_t op_cmp)
+static int __uolist_delete_all_by_key(uolist_t *uo, void *key, cmp_t op_cmp)
 {
-    int index = 0;
+    node_t *prev = NULL;
+    node_t *temp = NULL;
+    node_t *save = NULL;
+    int num = 0;
 
     /* 参数检查 */
     if (NULL == uo || NULL == key || NULL == op_cmp)
@@ -884,45 +1523,63 @@ int uolist_delete_all_by_key(uolist_t *uo, void *key, cmp_t op_cmp)
         goto ERR0;        
     } /* end of if (NULL == uo || NULL == key || NULL == op_cmp) */
 
-    while (1)
+    /* 展开链表模式 */
+    if (uo->flags & UOLIST_UNROLLED)
+    {
+        return unrolled_delete_all_by_key(uo, key, op_cmp);
+    } /* end of if (uo->flags & UOLIST_UNROLLED) */
+
+    /* 保留前驱节点, 一次遍历中原地摘除所有匹配节点 */
+    for (temp = uo->fstnode_p; NULL != temp; temp = save)
     {
-        /* 获取匹配索引 */
-        index = get_match_index(uo, key, op_cmp);
-        if (PAR_ERROR == index || MATCH_FAIL == index)
+        save = temp->next;
+
+        if (MATCH_SUCCESS != op_cmp(temp->data, key))
         {
-            goto ERR1;
-        } /* end of if (PAR_ERROR == index || MATCH_FAIL == index) */
+            prev = temp;
+            continue;
+        } /* end of if (MATCH_SUCCESS != op_cmp(temp->data, key)) */
 
+        // 连接节点
+        if (NULL == prev)
+        {
+            uo->fstnode_p = save;
+        }
+        else 
+        {
+            prev->next = save;
+        }
 
-        /* 根据索引删除节点 */
-        uolist_delete_by_index(uo, index);
+        // 释放节点
+        __node_free(uo, temp);
+        num++;
+    } /* end of for (temp = uo->fstnode_p; NULL != temp; temp = save) */
 
-    } /* end of while (1) */
+    /* 刷新信息 */
+    uo->lstnode_p = prev;
+    uo->count -= num;
+    uo->skdirty = 1;
 
-    return 0;
+    return num;
 
 ERR0:
     return PAR_ERROR;
-ERR1:
-    return FUN_ERROR;  
-
 }
 
 
 /**
- * @brief           链表根据关键字修改所有匹配节点的数据
+ * @brief           链表根据关键字修改所有匹配节点的数据(单次遍历)
  * @param           头信息结构体的指针
  * @param           修改的数据
  * @param           关键字
  * @param           自定义比较函数
- * @return          
- *      @arg  0:正常
+ * @return          修改的节点个数
  *      @arg  PAR_ERROR:参数错误
- *      @arg  FUN_ERROR:函数错误
  */
-int uolist_modify_all_by_key(uolist_t *uo, void *data, void *key, cmp_t op_cmp)
+static int __uolist_modify_all_by_key(uolist_t *uo, void *data, void *key, cmp_t op_cmp)
 {
-    int index = 0;
+    node_t *temp = NULL;
+    int num = 0;
 
     /* 参数检查 */
     if (NULL == uo || NULL == key || NULL == op_cmp || NULL == data)
@@ -935,27 +1592,78 @@ int uolist_modify_all_by_key(uolist_t *uo, void *data, void *key, cmp_t op_cmp)
         goto ERR0;        
     } /* end of if (NULL == uo || NULL == key || NULL == op_cmp || NULL == data) */
 
-    while (1)
+    /* 展开链表模式 */
+    if (uo->flags & UOLIST_UNROLLED)
+    {
+        return unrolled_modify_all_by_key(uo, data, key, op_cmp, NULL);
+    } /* end of if (uo->flags & UOLIST_UNROLLED) */
+
+    /* 每个匹配节点只修改一次, 修改后的数据即使仍匹配也不会重复处理 */
+    for (temp = uo->fstnode_p; NULL != temp; temp = temp->next)
     {
-        /* 获取匹配索引 */
-        index = get_match_index(uo, key, op_cmp);
-        if (PAR_ERROR == index || MATCH_FAIL == index)
+        if (MATCH_SUCCESS == op_cmp(temp->data, key))
         {
-            goto ERR1;
-        } /* end of if (PAR_ERROR == index || MATCH_FAIL == index) */
+            hindex_remove(uo, temp);
+            memcpy(temp->data, data, uo->size);
+            hindex_insert(uo, temp);
+            num++;
+        } /* end of if (MATCH_SUCCESS == op_cmp(temp->data, key)) */
+    } /* end of for (temp = uo->fstnode_p; NULL != temp; temp = temp->next) */
 
+    return num;
 
-        /* 根据索引修改数据 */
-        uolist_modify_by_index(uo, data, index);
+ERR0:
+    return PAR_ERROR;
+}
 
-    } /* end of while (1) */
 
-    return 0;
+/**
+ * @brief           链表根据关键字对所有匹配节点的数据原地调用自定义更新函数
+ * @param           头信息结构体的指针
+ * @param           关键字
+ * @param           自定义比较函数
+ * @param           自定义更新函数(参数为节点数据域)
+ * @return          更新的节点个数
+ *      @arg  PAR_ERROR:参数错误
+ */
+static int __uolist_update_all_by_key(uolist_t *uo, void *key, cmp_t op_cmp, op_t my_update)
+{
+    node_t *temp = NULL;
+    int num = 0;
+
+    /* 参数检查 */
+    if (NULL == uo || NULL == key || NULL == op_cmp || NULL == my_update)
+    {
+    #ifdef DEBUG
+        printf("uolist_update_all_by_key: Parameter error\n");
+    #elif defined FILE_DEBUG
+        
+    #endif
+        goto ERR0;        
+    } /* end of if (NULL == uo || NULL == key || NULL == op_cmp || NULL == my_update) */
+
+    /* 展开链表模式 */
+    if (uo->flags & UOLIST_UNROLLED)
+    {
+        return unrolled_modify_all_by_key(uo, NULL, key, op_cmp, my_update);
+    } /* end of if (uo->flags & UOLIST_UNROLLED) */
+
+    /* 单次遍历, 匹配节点原地更新 */
+    for (temp = uo->fstnode_p; NULL != temp; temp = temp->next)
+    {
+        if (MATCH_SUCCESS == op_cmp(temp->data, key))
+        {
+            hindex_remove(uo, temp);
+            my_update(temp->data);
+            hindex_insert(uo, temp);
+            num++;
+        } /* end of if (MATCH_SUCCESS == op_cmp(temp->data, key)) */
+    } /* end of for (temp = uo->fstnode_p; NULL != temp; temp = temp->next) */
+
+    return num;
 
 ERR0:
     return PAR_ERROR;
-ERR1:
-    return FUN_ERROR; 
 }
 
 
@@ -993,7 +1701,7 @@ int index_print(void *data)
  *      @arg  PAR_ERROR: 参数错误
  *      @arg  NULL     : 没有找到匹配索引
  */
-uolist_t *uolist_find_all_index_by_key(uolist_t *uo, void *key, cmp_t op_cmp)
+static uolist_t *__uolist_find_all_index_by_key(uolist_t *uo, void *key, cmp_t op_cmp)
 {
     uolist_t *index_head = NULL;
     node_t *temp = NULL;
@@ -1013,10 +1721,10 @@ uolist_t *uolist_find_all_index_by_key(uolist_t *uo, void *key, cmp_t op_cmp)
 
 
     /* 判断链表是否存在 */
-    if (NULL == uo->fstnode_p)
+    if (0 == uo->count)
     {
         goto ERR1;
-    } /* end of if (NULL == uo->fstnode_p) */
+    } /* end of if (0 == uo->count) */
 
 
     /* 创建存储索引的链表头信息结构体 */
@@ -1024,14 +1732,21 @@ uolist_t *uolist_find_all_index_by_key(uolist_t *uo, void *key, cmp_t op_cmp)
 
 
     /* 查找索引并插入链表 */
-    temp = uo->fstnode_p;
-    for (index = 0; NULL != temp; index++, temp = temp->next)
+    if (uo->flags & UOLIST_UNROLLED)
     {
-        if (MATCH_SUCCESS == op_cmp(temp->data, key))
+        unrolled_find_all_index(uo, key, op_cmp, index_head);
+    }
+    else
+    {
+        temp = uo->fstnode_p;
+        for (index = 0; NULL != temp; index++, temp = temp->next)
         {
-            uolist_append(index_head, &index);
-        }
-    } /* end of for (index = 0; NULL != temp; index++, temp = temp->next) */
+            if (MATCH_SUCCESS == op_cmp(temp->data, key))
+            {
+                uolist_append(index_head, &index);
+            }
+        } /* end of for (index = 0; NULL != temp; index++, temp = temp->next) */
+    }
 
 
     /* 判断是否为空链表 */
@@ -1053,12 +1768,13 @@ ERR1:
 
 /**
  * @brief           链表的翻转
+ * @details         翻转后退出有序模式
  * @param           头信息结构体的指针
  * @return          
  *      @arg  PAR_ERROR: 参数错误
  *      @arg  0        : 正常
  */
-int uolist_reverse(uolist_t *uo)
+static int __uolist_reverse(uolist_t *uo)
 {
     node_t *p = NULL;
     node_t *save = NULL;
@@ -1075,7 +1791,14 @@ int uolist_reverse(uolist_t *uo)
         goto ERR0;        
     } /* end of if (NULL == uo) */
 
-    /* 链表的翻转 */
+    /* 展开链表模式 */
+    if (uo->flags & UOLIST_UNROLLED)
+    {
+        return unrolled_reverse(uo);
+    } /* end of if (uo->flags & UOLIST_UNROLLED) */
+
+    /* 链表的翻转(原头节点成为新的尾节点) */
+    uo->lstnode_p = uo->fstnode_p;
     for (p = uo->fstnode_p, uo->fstnode_p = NULL, uo->count = 0; NULL != p; p = save)
     {
         /* 保存下一个节点 */
@@ -1097,14 +1820,2277 @@ int uolist_reverse(uolist_t *uo)
         /* 链表头信息更新 */
         uo->count++;
     } /* end of for (p = uo->fstnode_p, uo->fstnode_p = NULL, uo->count = 0; NULL != p; p = save) */
+    uo->skdirty = 1;
+    // 翻转后不再有序
+    uo->my_order = NULL;
+
+    return 0;
+
+
+ERR0:
+    return PAR_ERROR;
+
+
+}
+
+
+/**
+ * @brief           游标初始化, 指向链表的第一个节点
+ * @param           游标的指针
+ * @param           头信息结构体的指针
+ * @return          
+ *      @arg  0:正常
+ *      @arg  PAR_ERROR:参数错误
+ */
+int uolist_cursor_init(uolist_cursor_t *it, uolist_t *uo)
+{
+    /* 参数检查 */
+    if (NULL == it || NULL == uo)
+    {
+    #ifdef DEBUG
+        printf("uolist_cursor_init: Parameter error\n");
+    #elif defined FILE_DEBUG
+        
+    #endif
+        goto ERR0;        
+    } /* end of if (NULL == it || NULL == uo) */
+
+    /* 展开链表模式 */
+    if (uo->flags & UOLIST_UNROLLED)
+    {
+    #ifdef DEBUG
+        printf("uolist_cursor_init: not supported in UOLIST_UNROLLED mode\n");
+    #elif defined FILE_DEBUG
+        
+    #endif
+        return FUN_ERROR;
+    } /* end of if (uo->flags & UOLIST_UNROLLED) */
+
+    it->uo = uo;
+    it->prev = NULL;
+    it->cur = uo->fstnode_p;
 
     return 0;
 
+ERR0:
+    return PAR_ERROR;
+}
+
+
+/**
+ * @brief           游标移动到下一个节点
+ * @param           游标的指针
+ * @return          
+ *      @arg  0:正常
+ *      @arg  PAR_ERROR:参数错误
+ *      @arg  FUN_ERROR:已越过链表尾部
+ */
+int uolist_cursor_next(uolist_cursor_t *it)
+{
+    /* 参数检查 */
+    if (NULL == it)
+    {
+    #ifdef DEBUG
+        printf("uolist_cursor_next: Parameter error\n");
+    #elif defined FILE_DEBUG
+        
+    #endif
+        goto ERR0;        
+    } /* end of if (NULL == it) */
+
+    if (NULL == it->cur)
+    {
+        goto ERR1;
+    } /* end of if (NULL == it->cur) */
+
+    it->prev = it->cur;
+    it->cur = it->cur->next;
+
+    return 0;
 
 ERR0:
     return PAR_ERROR;
+ERR1:
+    return FUN_ERROR;
+}
 
 
+/**
+ * @brief           获取游标所在节点的数据
+ * @param           游标的指针
+ * @param           获取的数据
+ * @return          
+ *      @arg  0:正常
+ *      @arg  PAR_ERROR:参数错误
+ *      @arg  FUN_ERROR:已越过链表尾部
+ */
+int uolist_cursor_get(uolist_cursor_t *it, void *data)
+{
+    /* 参数检查 */
+    if (NULL == it || NULL == data)
+    {
+    #ifdef DEBUG
+        printf("uolist_cursor_get: Parameter error\n");
+    #elif defined FILE_DEBUG
+        
+    #endif
+        goto ERR0;        
+    } /* end of if (NULL == it || NULL == data) */
+
+    if (NULL == it->cur)
+    {
+        goto ERR1;
+    } /* end of if (NULL == it->cur) */
+
+    memcpy(data, it->cur->data, it->uo->size);
+
+    return 0;
+
+ERR0:
+    return PAR_ERROR;
+ERR1:
+    return FUN_ERROR;
+}
+
+
+/**
+ * @brief           修改游标所在节点的数据
+ * @param           游标的指针
+ * @param           修改的数据
+ * @return          
+ *      @arg  0:正常
+ *      @arg  PAR_ERROR:参数错误
+ *      @arg  FUN_ERROR:已越过链表尾部
+ */
+int uolist_cursor_set(uolist_cursor_t *it, void *data)
+{
+    /* 参数检查 */
+    if (NULL == it || NULL == data)
+    {
+    #ifdef DEBUG
+        printf("uolist_cursor_set: Parameter error\n");
+    #elif defined FILE_DEBUG
+        
+    #endif
+        goto ERR0;        
+    } /* end of if (NULL == it || NULL == data) */
+
+    if (NULL == it->cur)
+    {
+        goto ERR1;
+    } /* end of if (NULL == it->cur) */
+
+    hindex_remove(it->uo, it->cur);
+    memcpy(it->cur->data, data, it->uo->size);
+    hindex_insert(it->uo, it->cur);
+
+    return 0;
+
+ERR0:
+    return PAR_ERROR;
+ERR1:
+    return FUN_ERROR;
+}
+
+
+/**
+ * @brief           在游标所在节点之后插入节点, 游标位置不变
+ * @details         游标已越过链表尾部时插入到链表尾部
+ * @param           游标的指针
+ * @param           插入的数据
+ * @return          
+ *      @arg  0:正常
+ *      @arg  PAR_ERROR:参数错误
+ *      @arg  FUN_ERROR:函数错误
+ */
+int uolist_cursor_insert_after(uolist_cursor_t *it, void *data)
+{
+    uolist_t *uo = NULL;
+    node_t *temp = NULL;
+
+    /* 参数检查 */
+    if (NULL == it || NULL == data)
+    {
+    #ifdef DEBUG
+        printf("uolist_cursor_insert_after: Parameter error\n");
+    #elif defined FILE_DEBUG
+        
+    #endif
+        goto ERR0;        
+    } /* end of if (NULL == it || NULL == data) */
+
+    /* 1.创建一个新的节点 */
+    uo = it->uo;
+    temp = __node_alloc(uo, 1);
+    if (__node_invalid(temp))
+    {
+        goto ERR1;
+    } /* end of if (__node_invalid(temp)) */
+    memcpy(temp->data, data, uo->size);
+
+    /* 2.插入节点 */
+    if (NULL != it->cur)
+    {
+        // 插入到当前节点之后
+        __node_link(uo, it->cur, temp);
+    }
+    else 
+    {
+        // 游标越过尾部: 尾部插入, 游标仍停在尾部之后
+        __node_link(uo, uo->lstnode_p, temp);
+        it->prev = temp;
+    }
+
+    return 0;
+
+ERR0:
+    return PAR_ERROR;
+ERR1:
+    return FUN_ERROR;
+}
+
+
+/**
+ * @brief           删除游标所在节点, 游标移动到被删除节点的下一个节点
+ * @param           游标的指针
+ * @return          
+ *      @arg  0:正常
+ *      @arg  PAR_ERROR:参数错误
+ *      @arg  FUN_ERROR:已越过链表尾部
+ */
+int uolist_cursor_erase(uolist_cursor_t *it)
+{
+    uolist_t *uo = NULL;
+    node_t *des = NULL;
+
+    /* 参数检查 */
+    if (NULL == it)
+    {
+    #ifdef DEBUG
+        printf("uolist_cursor_erase: Parameter error\n");
+    #elif defined FILE_DEBUG
+        
+    #endif
+        goto ERR0;        
+    } /* end of if (NULL == it) */
+
+    if (NULL == it->cur)
+    {
+        goto ERR1;
+    } /* end of if (NULL == it->cur) */
+
+    /* 摘除并释放当前节点 */
+    uo = it->uo;
+    des = it->cur;
+    it->cur = des->next;
+    __node_unlink(uo, it->prev, des);
+    des = NULL;
+
+    return 0;
+
+ERR0:
+    return PAR_ERROR;
+ERR1:
+    return FUN_ERROR;
+}
+
+
+/**
+ * @brief           根据关键字查找匹配节点, 并将游标定位到该节点
+ * @param           头信息结构体的指针
+ * @param           关键字
+ * @param           自定义比较函数
+ * @param           游标的指针
+ * @return          
+ *      @arg  0:正常
+ *      @arg  PAR_ERROR:参数错误
+ *      @arg  MATCH_FAIL:无匹配节点
+ */
+int uolist_find_by_key(uolist_t *uo, void *key, cmp_t op_cmp, uolist_cursor_t *it)
+{
+    node_t *prev = NULL;
+    node_t *temp = NULL;
+
+    /* 参数检查 */
+    if (NULL == uo || NULL == key || NULL == op_cmp || NULL == it)
+    {
+    #ifdef DEBUG
+        printf("uolist_find_by_key: Parameter error\n");
+    #elif defined FILE_DEBUG
+        
+    #endif
+        goto ERR0;        
+    } /* end of if (NULL == uo || NULL == key || NULL == op_cmp || NULL == it) */
+
+    /* 展开链表模式 */
+    if (uo->flags & UOLIST_UNROLLED)
+    {
+    #ifdef DEBUG
+        printf("uolist_find_by_key: not supported in UOLIST_UNROLLED mode\n");
+    #elif defined FILE_DEBUG
+        
+    #endif
+        return FUN_ERROR;
+    } /* end of if (uo->flags & UOLIST_UNROLLED) */
+
+    /* 获取匹配节点及其前驱 */
+    temp = __node_find(uo, key, op_cmp, &prev);
+    if (NULL == temp)
+    {
+        goto ERR1;
+    } /* end of if (NULL == temp) */
+
+    /* 定位游标 */
+    it->uo = uo;
+    it->prev = prev;
+    it->cur = temp;
+
+    return 0;
+
+ERR0:
+    return PAR_ERROR;
+ERR1:
+    return MATCH_FAIL;
+}
+
+
+/**
+ * @brief           根据索引借用节点数据(不拷贝)
+ * @details         返回的指针在链表下一次插入/删除/销毁之前有效
+ * @param           头信息结构体的指针
+ * @param           索引值
+ * @return          指向节点数据的只读指针
+ *      @arg  PAR_ERROR:参数错误
+ */
+const void *uolist_borrow_by_index(uolist_t *uo, int index)
+{
+    /* 参数检查 */
+    if (NULL == uo || index < 0 || index >= uo->count)
+    {
+    #ifdef DEBUG
+        printf("uolist_borrow_by_index: Parameter error\n");
+    #elif defined FILE_DEBUG
+        
+    #endif
+        goto ERR0;        
+    } /* end of if (NULL == uo || index < 0 || index >= uo->count) */
+
+    /* 展开链表模式 */
+    if (uo->flags & UOLIST_UNROLLED)
+    {
+        return unrolled_at(uo, index);
+    } /* end of if (uo->flags & UOLIST_UNROLLED) */
+
+    return __node_at(uo, index)->data;
+
+ERR0:
+    return (void *)PAR_ERROR;
+}
+
+
+/**
+ * @brief           根据索引借用节点数据用于原地修改(不拷贝)
+ * @details         返回的指针在链表下一次插入/删除/销毁之前有效.
+ *                  UOLIST_CONCURRENT 模式下须持有 uolist_lock_write
+ * @param           头信息结构体的指针
+ * @param           索引值
+ * @return          指向节点数据的可写指针
+ *      @arg  PAR_ERROR:参数错误
+ */
+void *uolist_borrow_mut_by_index(uolist_t *uo, int index)
+{
+    /* 参数检查 */
+    if (NULL == uo || index < 0 || index >= uo->count)
+    {
+    #ifdef DEBUG
+        printf("uolist_borrow_mut_by_index: Parameter error\n");
+    #elif defined FILE_DEBUG
+        
+    #endif
+        goto ERR0;        
+    } /* end of if (NULL == uo || index < 0 || index >= uo->count) */
+
+    /* 展开链表模式 */
+    if (uo->flags & UOLIST_UNROLLED)
+    {
+        return unrolled_at(uo, index);
+    } /* end of if (uo->flags & UOLIST_UNROLLED) */
+
+    // 数据可能被调用者改写, 哈希索引随之失效
+    hindex_invalidate(uo);
+
+    return __node_at(uo, index)->data;
+
+ERR0:
+    return (void *)PAR_ERROR;
+}
+
+
+/**
+ * @brief           根据关键字借用节点数据(不拷贝)
+ * @details         返回的指针在链表下一次插入/删除/销毁之前有效
+ * @param           头信息结构体的指针
+ * @param           关键字
+ * @param           自定义比较函数
+ * @return          指向节点数据的只读指针
+ *      @arg  PAR_ERROR:参数错误
+ *      @arg  NULL     :无匹配节点
+ */
+const void *uolist_borrow_by_key(uolist_t *uo, void *key, cmp_t op_cmp)
+{
+    node_t *temp = NULL;
+
+    /* 参数检查 */
+    if (NULL == uo || NULL == key || NULL == op_cmp)
+    {
+    #ifdef DEBUG
+        printf("uolist_borrow_by_key: Parameter error\n");
+    #elif defined FILE_DEBUG
+        
+    #endif
+        goto ERR0;        
+    } /* end of if (NULL == uo || NULL == key || NULL == op_cmp) */
+
+    /* 展开链表模式 */
+    if (uo->flags & UOLIST_UNROLLED)
+    {
+        return unrolled_find(uo, key, op_cmp, NULL);
+    } /* end of if (uo->flags & UOLIST_UNROLLED) */
+
+    /* 获取匹配节点 */
+    temp = __node_find(uo, key, op_cmp, NULL);
+    if (NULL == temp)
+    {
+        goto ERR1;
+    } /* end of if (NULL == temp) */
+
+    return temp->data;
+
+ERR0:
+    return (void *)PAR_ERROR;
+ERR1:
+    return NULL;
+}
+
+
+/**
+ * @brief           根据关键字借用节点数据用于原地修改(不拷贝)
+ * @details         返回的指针在链表下一次插入/删除/销毁之前有效.
+ *                  UOLIST_CONCURRENT 模式下须持有 uolist_lock_write
+ * @param           头信息结构体的指针
+ * @param           关键字
+ * @param           自定义比较函数
+ * @return          指向节点数据的可写指针
+ *      @arg  PAR_ERROR:参数错误
+ *      @arg  NULL     :无匹配节点
+ */
+void *uolist_borrow_mut_by_key(uolist_t *uo, void *key, cmp_t op_cmp)
+{
+    node_t *temp = NULL;
+
+    /* 参数检查 */
+    if (NULL == uo || NULL == key || NULL == op_cmp)
+    {
+    #ifdef DEBUG
+        printf("uolist_borrow_mut_by_key: Parameter error\n");
+    #elif defined FILE_DEBUG
+        
+    #endif
+        goto ERR0;        
+    } /* end of if (NULL == uo || NULL == key || NULL == op_cmp) */
+
+    /* 展开链表模式 */
+    if (uo->flags & UOLIST_UNROLLED)
+    {
+        return unrolled_find(uo, key, op_cmp, NULL);
+    } /* end of if (uo->flags & UOLIST_UNROLLED) */
+
+    /* 获取匹配节点 */
+    temp = __node_find(uo, key, op_cmp, NULL);
+    if (NULL == temp)
+    {
+        goto ERR1;
+    } /* end of if (NULL == temp) */
+
+    // 数据可能被调用者改写, 哈希索引随之失效
+    hindex_invalidate(uo);
+
+    return temp->data;
+
+ERR0:
+    return (void *)PAR_ERROR;
+ERR1:
+    return NULL;
+}
+
+
+/**
+ * @brief           链表头部原地构造插入
+ * @details         返回的数据空间未初始化, 由调用者直接写入
+ * @param           头信息结构体的指针
+ * @return          指向新节点数据域的指针
+ *      @arg  PAR_ERROR:参数错误
+ *      @arg  FUN_ERROR:函数错误
+ */
+void *uolist_emplace_prepend(uolist_t *uo)
+{
+    void *elem = NULL;
+    node_t *temp = NULL;
+
+    /* 参数检查 */
+    if (NULL == uo)
+    {
+    #ifdef DEBUG
+        printf("uolist_emplace_prepend: Parameter error\n");
+    #elif defined FILE_DEBUG
+        
+    #endif
+        goto ERR0;        
+    } /* end of if (NULL == uo) */
+
+    /* 展开链表模式 */
+    if (uo->flags & UOLIST_UNROLLED)
+    {
+        elem = unrolled_insert(uo, 0);
+        if (NULL == elem)
+        {
+            goto ERR1;
+        } /* end of if (NULL == elem) */
+        return elem;
+    } /* end of if (uo->flags & UOLIST_UNROLLED) */
+
+    /* 1.创建一个新的节点(数据空间不清零) */
+    temp = __node_alloc(uo, 0);
+    if (__node_invalid(temp))
+    {
+        goto ERR1;
+    } /* end of if (__node_invalid(temp)) */
+
+    /* 2.插入节点(数据尚未写入, 哈希索引随之失效) */
+    hindex_invalidate(uo);
+    __node_link_at(uo, 0, temp);
+
+    return temp->data;
+
+ERR0:
+    return (void *)PAR_ERROR;
+ERR1:
+    return (void *)FUN_ERROR;
+}
+
+
+/**
+ * @brief           链表尾部原地构造插入
+ * @details         返回的数据空间未初始化, 由调用者直接写入
+ * @param           头信息结构体的指针
+ * @return          指向新节点数据域的指针
+ *      @arg  PAR_ERROR:参数错误
+ *      @arg  FUN_ERROR:函数错误
+ */
+void *uolist_emplace_append(uolist_t *uo)
+{
+    void *elem = NULL;
+    node_t *temp = NULL;
+
+    /* 参数检查 */
+    if (NULL == uo)
+    {
+    #ifdef DEBUG
+        printf("uolist_emplace_append: Parameter error\n");
+    #elif defined FILE_DEBUG
+        
+    #endif
+        goto ERR0;        
+    } /* end of if (NULL == uo) */
+
+    /* 展开链表模式 */
+    if (uo->flags & UOLIST_UNROLLED)
+    {
+        elem = unrolled_insert(uo, uo->count);
+        if (NULL == elem)
+        {
+            goto ERR1;
+        } /* end of if (NULL == elem) */
+        return elem;
+    } /* end of if (uo->flags & UOLIST_UNROLLED) */
+
+    /* 1.创建一个新的节点(数据空间不清零) */
+    temp = __node_alloc(uo, 0);
+    if (__node_invalid(temp))
+    {
+        goto ERR1;
+    } /* end of if (__node_invalid(temp)) */
+
+    /* 2.插入节点(数据尚未写入, 哈希索引随之失效) */
+    hindex_invalidate(uo);
+    __node_link_at(uo, uo->count, temp);
+
+    return temp->data;
+
+ERR0:
+    return (void *)PAR_ERROR;
+ERR1:
+    return (void *)FUN_ERROR;
+}
+
+
+/**
+ * @brief           链表根据索引原地构造插入
+ * @details         返回的数据空间未初始化, 由调用者直接写入
+ * @param           头信息结构体的指针
+ * @param           索引值
+ * @return          指向新节点数据域的指针
+ *      @arg  PAR_ERROR:参数错误
+ *      @arg  FUN_ERROR:函数错误
+ */
+void *uolist_emplace_by_index(uolist_t *uo, int index)
+{
+    void *elem = NULL;
+    node_t *temp = NULL;
+
+    /* 参数检查 */
+    if (NULL == uo || index < 0)
+    {
+    #ifdef DEBUG
+        printf("uolist_emplace_by_index: Parameter error\n");
+    #elif defined FILE_DEBUG
+        
+    #endif
+        goto ERR0;        
+    } /* end of if (NULL == uo || index < 0) */
+
+    /* 展开链表模式 */
+    if (uo->flags & UOLIST_UNROLLED)
+    {
+        elem = unrolled_insert(uo, index);
+        if (NULL == elem)
+        {
+            goto ERR1;
+        } /* end of if (NULL == elem) */
+        return elem;
+    } /* end of if (uo->flags & UOLIST_UNROLLED) */
+
+    /* 1.创建一个新的节点(数据空间不清零) */
+    temp = __node_alloc(uo, 0);
+    if (__node_invalid(temp))
+    {
+        goto ERR1;
+    } /* end of if (__node_invalid(temp)) */
+
+    /* 2.插入节点(数据尚未写入, 哈希索引随之失效) */
+    hindex_invalidate(uo);
+    __node_link_at(uo, index, temp);
+
+    return temp->data;
+
+ERR0:
+    return (void *)PAR_ERROR;
+ERR1:
+    return (void *)FUN_ERROR;
+}
+
+
+/**
+ * @brief           链表尾部批量插入
+ * @details         节点链构建完成后一次接到链表尾部, UOLIST_POOL 模式下只申请一次空间
+ * @param           头信息结构体的指针
+ * @param           连续存放的 n 个数据(每个数据 size 字节)
+ * @param           数据个数
+ * @return          
+ *      @arg  0:正常
+ *      @arg  PAR_ERROR:参数错误
+ *      @arg  FUN_ERROR:函数错误
+ */
+static int __uolist_append_bulk(uolist_t *uo, void *data, int n)
+{
+    node_t *first = NULL;
+    node_t *last = NULL;
+
+    /* 参数检查 */
+    if (NULL == uo || NULL == data || n < 0)
+    {
+    #ifdef DEBUG
+        printf("uolist_append_bulk: Parameter error\n");
+    #elif defined FILE_DEBUG
+        
+    #endif
+        goto ERR0;        
+    } /* end of if (NULL == uo || NULL == data || n < 0) */
+
+    if (0 == n)
+    {
+        return 0;
+    } /* end of if (0 == n) */
+
+    /* 展开链表模式 */
+    if (uo->flags & UOLIST_UNROLLED)
+    {
+        return unrolled_append_bulk(uo, data, n);
+    } /* end of if (uo->flags & UOLIST_UNROLLED) */
+
+    /* 1.构建节点链 */
+    if (0 != __chain_build(uo, data, n, &first, &last))
+    {
+        goto ERR1;
+    } /* end of if (0 != __chain_build(uo, data, n, &first, &last)) */
+
+    /* 2.整条节点链接到尾部 */
+    if (NULL == uo->lstnode_p)
+    {
+        uo->fstnode_p = first;
+    }
+    else 
+    {
+        uo->lstnode_p->next = first;
+    }
+    uo->lstnode_p = last;
+
+    /* 3.刷新信息 */
+    uo->count += n;
+    uo->skdirty = 1;
+    hindex_invalidate(uo);
+
+    return 0;
+
+ERR0:
+    return PAR_ERROR;
+ERR1:
+    return FUN_ERROR;
+}
+
+
+/**
+ * @brief           链表头部批量插入
+ * @details         插入后数组中的数据依次位于索引 0 ~ n-1, UOLIST_POOL 模式下只申请一次空间
+ * @param           头信息结构体的指针
+ * @param           连续存放的 n 个数据(每个数据 size 字节)
+ * @param           数据个数
+ * @return          
+ *      @arg  0:正常
+ *      @arg  PAR_ERROR:参数错误
+ *      @arg  FUN_ERROR:函数错误
+ */
+static int __uolist_prepend_bulk(uolist_t *uo, void *data, int n)
+{
+    node_t *first = NULL;
+    node_t *last = NULL;
+
+    /* 参数检查 */
+    if (NULL == uo || NULL == data || n < 0)
+    {
+    #ifdef DEBUG
+        printf("uolist_prepend_bulk: Parameter error\n");
+    #elif defined FILE_DEBUG
+        
+    #endif
+        goto ERR0;        
+    } /* end of if (NULL == uo || NULL == data || n < 0) */
+
+    if (0 == n)
+    {
+        return 0;
+    } /* end of if (0 == n) */
+
+    /* 展开链表模式 */
+    if (uo->flags & UOLIST_UNROLLED)
+    {
+        return unrolled_prepend_bulk(uo, data, n);
+    } /* end of if (uo->flags & UOLIST_UNROLLED) */
+
+    /* 1.构建节点链 */
+    if (0 != __chain_build(uo, data, n, &first, &last))
+    {
+        goto ERR1;
+    } /* end of if (0 != __chain_build(uo, data, n, &first, &last)) */
+
+    /* 2.整条节点链接到头部 */
+    last->next = uo->fstnode_p;
+    uo->fstnode_p = first;
+    if (NULL == uo->lstnode_p)
+    {
+        uo->lstnode_p = last;
+    } /* end of if (NULL == uo->lstnode_p) */
+
+    /* 3.刷新信息 */
+    uo->count += n;
+    uo->skdirty = 1;
+    hindex_invalidate(uo);
+
+    return 0;
+
+ERR0:
+    return PAR_ERROR;
+ERR1:
+    return FUN_ERROR;
+}
+
+
+/**
+ * @brief           将链表全部数据依次导出到连续空间
+ * @details         传入空间为 NULL 时申请 count * size 字节的新空间(由调用者 free);
+ *                  预取距离大于 0 时提前预取之后第 n 个节点, 减少遍历时的缓存缺失
+ * @param           头信息结构体的指针
+ * @param           导出空间(至少 count * size 字节), 可为 NULL
+ * @param           预取距离(0 为不预取)
+ * @return          导出空间的指针(空链表且未传入空间时为 NULL)
+ *      @arg  PAR_ERROR:参数错误
+ *      @arg  FUN_ERROR:函数错误
+ */
+static void *__uolist_to_array(uolist_t *uo, void *buf, int prefetch)
+{
+    node_t *temp = NULL;
+    node_t *ahead = NULL;
+    char *dst = NULL;
+    int i = 0;
+
+    /* 参数检查 */
+    if (NULL == uo || prefetch < 0)
+    {
+    #ifdef DEBUG
+        printf("uolist_to_array: Parameter error\n");
+    #elif defined FILE_DEBUG
+        
+    #endif
+        goto ERR0;        
+    } /* end of if (NULL == uo || prefetch < 0) */
+
+    /* 申请导出空间 */
+    if (NULL == buf && uo->count > 0)
+    {
+        buf = malloc((size_t)uo->count * uo->size);
+        if (NULL == buf)
+        {
+        #ifdef DEBUG
+            printf("uolist_to_array: malloc error\n");
+        #elif defined FILE_DEBUG
+            
+        #endif
+            goto ERR1;
+        } /* end of if (NULL == buf) */
+    } /* end of if (NULL == buf && uo->count > 0) */
+
+    /* 展开链表模式: 按节点整块拷贝 */
+    if (uo->flags & UOLIST_UNROLLED)
+    {
+        unrolled_to_array(uo, buf);
+        return buf;
+    } /* end of if (uo->flags & UOLIST_UNROLLED) */
+
+    /* 预取指针先行 prefetch 个节点 */
+    ahead = uo->fstnode_p;
+    for (i = 0; i < prefetch && NULL != ahead; i++)
+    {
+        ahead = ahead->next;
+    } /* end of for (i = 0; i < prefetch && NULL != ahead; i++) */
+
+    /* 依次拷贝数据 */
+    dst = (char *)buf;
+    for (temp = uo->fstnode_p; NULL != temp; temp = temp->next, dst += uo->size)
+    {
+        if (NULL != ahead)
+        {
+        #ifdef __GNUC__
+            __builtin_prefetch(ahead->next);
+            __builtin_prefetch(ahead->data);
+        #endif
+            ahead = ahead->next;
+        } /* end of if (NULL != ahead) */
+
+        memcpy(dst, temp->data, uo->size);
+    } /* end of for (temp = uo->fstnode_p; NULL != temp; temp = temp->next, dst += uo->size) */
+
+    return buf;
+
+ERR0:
+    return (void *)PAR_ERROR;
+ERR1:
+    return (void *)FUN_ERROR;
+}
+
+
+/**
+ * @brief           为链表附加哈希索引
+ * @param           头信息结构体的指针
+ * @param           自定义哈希函数
+ * @param           与哈希函数配套的比较函数
+ * @return          
+ *      @arg  0:正常
+ *      @arg  PAR_ERROR:参数错误
+ *      @arg  FUN_ERROR:函数错误
+ */
+static int __uolist_hash_attach(uolist_t *uo, hash_t my_hash, cmp_t op_cmp)
+{
+    /* 参数检查 */
+    if (NULL == uo || NULL == my_hash || NULL == op_cmp)
+    {
+    #ifdef DEBUG
+        printf("uolist_hash_attach: Parameter error\n");
+    #elif defined FILE_DEBUG
+        
+    #endif
+        goto ERR0;        
+    } /* end of if (NULL == uo || NULL == my_hash || NULL == op_cmp) */
+
+    /* 展开链表模式不支持 */
+    if (uo->flags & UOLIST_UNROLLED)
+    {
+    #ifdef DEBUG
+        printf("uolist_hash_attach: not supported in UOLIST_UNROLLED mode\n");
+    #elif defined FILE_DEBUG
+        
+    #endif
+        goto ERR1;
+    } /* end of if (uo->flags & UOLIST_UNROLLED) */
+
+    /* 创建索引, 首次按关键字访问时建立表项 */
+    if (0 != hindex_attach(uo, my_hash, op_cmp))
+    {
+        goto ERR1;
+    } /* end of if (0 != hindex_attach(uo, my_hash, op_cmp)) */
+
+    return 0;
+
+ERR0:
+    return PAR_ERROR;
+ERR1:
+    return FUN_ERROR;
+}
+
+
+/**
+ * @brief           移除链表的哈希索引
+ * @param           头信息结构体的指针
+ * @return          
+ *      @arg  0:正常
+ *      @arg  PAR_ERROR:参数错误
+ */
+static int __uolist_hash_detach(uolist_t *uo)
+{
+    /* 参数检查 */
+    if (NULL == uo)
+    {
+    #ifdef DEBUG
+        printf("uolist_hash_detach: Parameter error\n");
+    #elif defined FILE_DEBUG
+        
+    #endif
+        goto ERR0;        
+    } /* end of if (NULL == uo) */
+
+    hindex_release(uo);
+
+    return 0;
+
+ERR0:
+    return PAR_ERROR;
+}
+
+
+/**
+ * @brief           设置三路比较函数, 进入有序模式
+ * @param           头信息结构体的指针
+ * @param           三路比较函数(为 NULL 时退出有序模式)
+ * @return          
+ *      @arg  0:正常
+ *      @arg  PAR_ERROR:参数错误
+ *      @arg  FUN_ERROR:函数错误(链表未按该顺序排列)
+ */
+static int __uolist_set_order(uolist_t *uo, order_t my_order)
+{
+    node_t *temp = NULL;
+
+    /* 参数检查 */
+    if (NULL == uo)
+    {
+    #ifdef DEBUG
+        printf("uolist_set_order: Parameter error\n");
+    #elif defined FILE_DEBUG
+        
+    #endif
+        goto ERR0;        
+    } /* end of if (NULL == uo) */
+
+    /* 展开链表模式不支持 */
+    if (uo->flags & UOLIST_UNROLLED)
+    {
+    #ifdef DEBUG
+        printf("uolist_set_order: not supported in UOLIST_UNROLLED mode\n");
+    #elif defined FILE_DEBUG
+        
+    #endif
+        goto ERR1;
+    } /* end of if (uo->flags & UOLIST_UNROLLED) */
+
+    /* 检查链表是否已按该顺序排列 */
+    for (temp = uo->fstnode_p; NULL != my_order && NULL != temp && NULL != temp->next; temp = temp->next)
+    {
+        if (my_order(temp->data, temp->next->data) > 0)
+        {
+            goto ERR1;
+        } /* end of if (my_order(temp->data, temp->next->data) > 0) */
+    } /* end of for (temp = uo->fstnode_p; ...; temp = temp->next) */
+
+    uo->my_order = my_order;
+
+    return 0;
+
+ERR0:
+    return PAR_ERROR;
+ERR1:
+    return FUN_ERROR;
+}
+
+
+/**
+ * @brief           有序插入(插入到所有相等数据之后, 单次遍历)
+ * @param           头信息结构体的指针
+ * @param           插入节点数据
+ * @return          
+ *      @arg  0:正常
+ *      @arg  PAR_ERROR:参数错误
+ *      @arg  FUN_ERROR:函数错误
+ */
+static int __uolist_insert_sorted(uolist_t *uo, void *data)
+{
+    node_t *prev = NULL;
+    node_t *temp = NULL;
+    int index = 0;
+
+    /* 参数检查 */
+    if (NULL == uo || NULL == data)
+    {
+    #ifdef DEBUG
+        printf("uolist_insert_sorted: Parameter error\n");
+    #elif defined FILE_DEBUG
+        
+    #endif
+        goto ERR0;        
+    } /* end of if (NULL == uo || NULL == data) */
+
+    /* 有序模式检查 */
+    if (NULL == uo->my_order)
+    {
+    #ifdef DEBUG
+        printf("uolist_insert_sorted: order function not set\n");
+    #elif defined FILE_DEBUG
+        
+    #endif
+        goto ERR1;
+    } /* end of if (NULL == uo->my_order) */
+
+    /* 1.创建一个新的节点 */
+    temp = __node_alloc(uo, 1);
+    if (__node_invalid(temp))
+    {
+        goto ERR1;
+    } /* end of if (__node_invalid(temp)) */
+    memcpy(temp->data, data, uo->size);
+
+    /* 2.不小于尾节点时直接尾部插入 */
+    if (NULL == uo->lstnode_p || uo->my_order(uo->lstnode_p->data, data) <= 0)
+    {
+        __node_link_at(uo, uo->count, temp);
+        return 0;
+    } /* end of if (NULL == uo->lstnode_p || uo->my_order(uo->lstnode_p->data, data) <= 0) */
+
+    /* 3.插入到第一个大于该数据的节点之前 */
+    __node_seek(uo, data, 1, &prev, &index);
+    if (uo->flags & UOLIST_SKIPLIST)
+    {
+        __node_link_at(uo, index, temp);
+    }
+    else 
+    {
+        __node_link(uo, prev, temp);
+    }
+
+    return 0;
+
+ERR0:
+    return PAR_ERROR;
+ERR1:
+    return FUN_ERROR;
+}
+
+
+/**
+ * @brief           有序查找第一个等于关键字的索引(遇到更大的数据即停止)
+ * @param           头信息结构体的指针
+ * @param           关键字
+ * @return          索引值
+ *      @arg  PAR_ERROR:参数错误
+ *      @arg  MATCH_FAIL:无匹配索引
+ */
+static int __uolist_find_sorted(uolist_t *uo, void *key)
+{
+    node_t *prev = NULL;
+    node_t *temp = NULL;
+    int index = 0;
+
+    /* 参数检查 */
+    if (NULL == uo || NULL == key)
+    {
+    #ifdef DEBUG
+        printf("uolist_find_sorted: Parameter error\n");
+    #elif defined FILE_DEBUG
+        
+    #endif
+        goto ERR0;        
+    } /* end of if (NULL == uo || NULL == key) */
+
+    /* 有序模式检查 */
+    if (NULL == uo->my_order)
+    {
+    #ifdef DEBUG
+        printf("uolist_find_sorted: order function not set\n");
+    #elif defined FILE_DEBUG
+        
+    #endif
+        goto ERR1;
+    } /* end of if (NULL == uo->my_order) */
+
+    temp = __node_seek(uo, key, 0, &prev, &index);
+    if (NULL == temp || 0 != uo->my_order(temp->data, key))
+    {
+        goto ERR1;
+    } /* end of if (NULL == temp || 0 != uo->my_order(temp->data, key)) */
+
+    return index;
+
+ERR0:
+    return PAR_ERROR;
+ERR1:
+    return MATCH_FAIL;
+}
+
+
+/**
+ * @brief           有序获取第一个等于关键字的数据(遇到更大的数据即停止)
+ * @param           头信息结构体的指针
+ * @param           获取的数据
+ * @param           关键字
+ * @return          
+ *      @arg  0:正常
+ *      @arg  PAR_ERROR:参数错误
+ *      @arg  FUN_ERROR:无匹配数据
+ */
+static int __uolist_retrieve_sorted(uolist_t *uo, void *data, void *key)
+{
+    node_t *prev = NULL;
+    node_t *temp = NULL;
+    int index = 0;
+
+    /* 参数检查 */
+    if (NULL == uo || NULL == data || NULL == key)
+    {
+    #ifdef DEBUG
+        printf("uolist_retrieve_sorted: Parameter error\n");
+    #elif defined FILE_DEBUG
+        
+    #endif
+        goto ERR0;        
+    } /* end of if (NULL == uo || NULL == data || NULL == key) */
+
+    /* 有序模式检查 */
+    if (NULL == uo->my_order)
+    {
+    #ifdef DEBUG
+        printf("uolist_retrieve_sorted: order function not set\n");
+    #elif defined FILE_DEBUG
+        
+    #endif
+        goto ERR1;
+    } /* end of if (NULL == uo->my_order) */
+
+    temp = __node_seek(uo, key, 0, &prev, &index);
+    if (NULL == temp || 0 != uo->my_order(temp->data, key))
+    {
+        goto ERR1;
+    } /* end of if (NULL == temp || 0 != uo->my_order(temp->data, key)) */
+
+    memcpy(data, temp->data, uo->size);
+
+    return 0;
+
+ERR0:
+    return PAR_ERROR;
+ERR1:
+    return FUN_ERROR;
+}
+
+
+/**
+ * @brief           有序删除第一个等于关键字的数据(遇到更大的数据即停止)
+ * @param           头信息结构体的指针
+ * @param           关键字
+ * @return          
+ *      @arg  0:正常
+ *      @arg  PAR_ERROR:参数错误
+ *      @arg  FUN_ERROR:无匹配数据
+ */
+static int __uolist_delete_sorted(uolist_t *uo, void *key)
+{
+    node_t *prev = NULL;
+    node_t *temp = NULL;
+    int index = 0;
+
+    /* 参数检查 */
+    if (NULL == uo || NULL == key)
+    {
+    #ifdef DEBUG
+        printf("uolist_delete_sorted: Parameter error\n");
+    #elif defined FILE_DEBUG
+        
+    #endif
+        goto ERR0;        
+    } /* end of if (NULL == uo || NULL == key) */
+
+    /* 有序模式检查 */
+    if (NULL == uo->my_order)
+    {
+    #ifdef DEBUG
+        printf("uolist_delete_sorted: order function not set\n");
+    #elif defined FILE_DEBUG
+        
+    #endif
+        goto ERR1;
+    } /* end of if (NULL == uo->my_order) */
+
+    temp = __node_seek(uo, key, 0, &prev, &index);
+    if (NULL == temp || 0 != uo->my_order(temp->data, key))
+    {
+        goto ERR1;
+    } /* end of if (NULL == temp || 0 != uo->my_order(temp->data, key)) */
+
+    /* 摘除节点, 跳表模式下同步维护索引 */
+    if (uo->flags & UOLIST_SKIPLIST)
+    {
+        __node_free(uo, skiplist_unlink(uo, index));
+    }
+    else 
+    {
+        __node_unlink(uo, prev, temp);
+    }
+
+    return 0;
+
+ERR0:
+    return PAR_ERROR;
+ERR1:
+    return FUN_ERROR;
+}
+
+
+/**
+ * @brief           稳定排序(自底向上的自然归并排序)
+ * @param           头信息结构体的指针
+ * @param           三路比较函数(为 NULL 时使用 uolist_set_order 所设置的比较函数)
+ * @return          
+ *      @arg  0:正常
+ *      @arg  PAR_ERROR:参数错误
+ *      @arg  FUN_ERROR:函数错误
+ */
+static int __uolist_sort(uolist_t *uo, order_t my_order)
+{
+    /* 参数检查 */
+    if (NULL == uo || (NULL == my_order && NULL == uo->my_order))
+    {
+    #ifdef DEBUG
+        printf("uolist_sort: Parameter error\n");
+    #elif defined FILE_DEBUG
+        
+    #endif
+        goto ERR0;        
+    } /* end of if (NULL == uo || (NULL == my_order && NULL == uo->my_order)) */
+
+    /* 展开链表模式不支持 */
+    if (uo->flags & UOLIST_UNROLLED)
+    {
+    #ifdef DEBUG
+        printf("uolist_sort: not supported in UOLIST_UNROLLED mode\n");
+    #elif defined FILE_DEBUG
+        
+    #endif
+        goto ERR1;
+    } /* end of if (uo->flags & UOLIST_UNROLLED) */
+
+    if (NULL == my_order)
+    {
+        my_order = uo->my_order;
+    } /* end of if (NULL == my_order) */
+
+    /* 排序后按索引的位置全部改变, 跳表索引随之失效 */
+    sort_merge(uo, my_order);
+    uo->skdirty = 1;
+    if (my_order != uo->my_order)
+    {
+        uo->my_order = NULL;
+    } /* end of if (my_order != uo->my_order) */
+
+    return 0;
+
+ERR0:
+    return PAR_ERROR;
+ERR1:
+    return FUN_ERROR;
+}
+
+
+/**
+ * @brief           基数排序(按无符号整数关键字升序, 稳定)
+ * @param           头信息结构体的指针
+ * @param           自定义关键字提取函数
+ * @return          
+ *      @arg  0:正常
+ *      @arg  PAR_ERROR:参数错误
+ *      @arg  FUN_ERROR:函数错误
+ */
+static int __uolist_radix_sort(uolist_t *uo, radix_t my_key)
+{
+    /* 参数检查 */
+    if (NULL == uo || NULL == my_key)
+    {
+    #ifdef DEBUG
+        printf("uolist_radix_sort: Parameter error\n");
+    #elif defined FILE_DEBUG
+        
+    #endif
+        goto ERR0;        
+    } /* end of if (NULL == uo || NULL == my_key) */
+
+    /* 展开链表模式不支持 */
+    if (uo->flags & UOLIST_UNROLLED)
+    {
+    #ifdef DEBUG
+        printf("uolist_radix_sort: not supported in UOLIST_UNROLLED mode\n");
+    #elif defined FILE_DEBUG
+        
+    #endif
+        goto ERR1;
+    } /* end of if (uo->flags & UOLIST_UNROLLED) */
+
+    /* 排序后按索引的位置全部改变, 跳表索引随之失效 */
+    if (0 != sort_radix(uo, my_key))
+    {
+        goto ERR1;
+    } /* end of if (0 != sort_radix(uo, my_key)) */
+    uo->skdirty = 1;
+    uo->my_order = NULL;
+
+    return 0;
+
+ERR0:
+    return PAR_ERROR;
+ERR1:
+    return FUN_ERROR;
+}
+
+
+/**
+ * @brief           多线程稳定排序
+ * @param           头信息结构体的指针
+ * @param           三路比较函数(为 NULL 时使用 uolist_set_order 所设置的比较函数)
+ * @param           线程数(小于等于 0 时使用在线的处理器个数)
+ * @return          
+ *      @arg  0:正常
+ *      @arg  PAR_ERROR:参数错误
+ *      @arg  FUN_ERROR:函数错误
+ */
+static int __uolist_parallel_sort(uolist_t *uo, order_t my_order, int nthreads)
+{
+    /* 参数检查 */
+    if (NULL == uo || (NULL == my_order && NULL == uo->my_order))
+    {
+    #ifdef DEBUG
+        printf("uolist_parallel_sort: Parameter error\n");
+    #elif defined FILE_DEBUG
+        
+    #endif
+        goto ERR0;        
+    } /* end of if (NULL == uo || (NULL == my_order && NULL == uo->my_order)) */
+
+    /* 展开链表模式不支持 */
+    if (uo->flags & UOLIST_UNROLLED)
+    {
+    #ifdef DEBUG
+        printf("uolist_parallel_sort: not supported in UOLIST_UNROLLED mode\n");
+    #elif defined FILE_DEBUG
+        
+    #endif
+        goto ERR1;
+    } /* end of if (uo->flags & UOLIST_UNROLLED) */
+
+    if (NULL == my_order)
+    {
+        my_order = uo->my_order;
+    } /* end of if (NULL == my_order) */
+
+    /* 排序后按索引的位置全部改变, 跳表索引随之失效 */
+    sort_parallel(uo, my_order, nthreads);
+    uo->skdirty = 1;
+    if (my_order != uo->my_order)
+    {
+        uo->my_order = NULL;
+    } /* end of if (my_order != uo->my_order) */
+
+    return 0;
+
+ERR0:
+    return PAR_ERROR;
+ERR1:
+    return FUN_ERROR;
+}
+
+
+/**
+ * @brief           将源链表的全部节点接到目标链表尾部
+ * @param           目标链表头信息结构体的指针
+ * @param           源链表头信息结构体的指针(完成后为空链表)
+ * @return          
+ *      @arg  0:正常
+ *      @arg  PAR_ERROR:参数错误
+ */
+static int __uolist_concat(uolist_t *dst, uolist_t *src)
+{
+    /* 参数检查 */
+    if (NULL == dst || NULL == src || dst == src || dst->size != src->size
+        || (dst->flags & ~(UOLIST_SKIPLIST | UOLIST_CONCURRENT))
+            != (src->flags & ~(UOLIST_SKIPLIST | UOLIST_CONCURRENT)))
+    {
+    #ifdef DEBUG
+        printf("uolist_concat: Parameter error\n");
+    #elif defined FILE_DEBUG
+        
+    #endif
+        goto ERR0;        
+    } /* end of if (NULL == dst || NULL == src || dst == src || ...) */
+
+    /* 源链表为空时无需处理 */
+    if (0 == src->count)
+    {
+        return 0;
+    } /* end of if (0 == src->count) */
+
+    /* 展开链表模式 */
+    if (dst->flags & UOLIST_UNROLLED)
+    {
+        return unrolled_concat(dst, src);
+    } /* end of if (dst->flags & UOLIST_UNROLLED) */
+
+    /* 1.节点链整体接到尾部 */
+    if (NULL == dst->lstnode_p)
+    {
+        dst->fstnode_p = src->fstnode_p;
+    }
+    else 
+    {
+        dst->lstnode_p->next = src->fstnode_p;
+    }
+    dst->lstnode_p = src->lstnode_p;
+    dst->count += src->count;
+
+    /* 2.内存池模式下节点所在的大块一并移交 */
+    if (dst->flags & UOLIST_POOL)
+    {
+        __pool_merge(dst, src);
+    } /* end of if (dst->flags & UOLIST_POOL) */
+
+    /* 3.刷新信息, 各索引随之失效 */
+    src->fstnode_p = NULL;
+    src->lstnode_p = NULL;
+    src->count = 0;
+    src->skdirty = 1;
+    hindex_clear(src);
+    dst->skdirty = 1;
+    hindex_invalidate(dst);
+    dst->my_order = NULL;
+
+    return 0;
+
+ERR0:
+    return PAR_ERROR;
+}
+
+
+/**
+ * @brief           从索引位置将链表拆分为两个链表
+ * @param           头信息结构体的指针
+ * @param           索引值(0 <= index <= count)
+ * @return          指向后半部分链表头信息结构体的指针
+ *      @arg  PAR_ERROR:参数错误
+ *      @arg  FUN_ERROR:函数错误(链表不变)
+ */
+static uolist_t *__uolist_split_at(uolist_t *uo, int index)
+{
+    uolist_t *dst = NULL;
+    node_t *prev = NULL;
+    node_t *temp = NULL;
+    node_t *save = NULL;
+
+    /* 参数检查 */
+    if (NULL == uo || index < 0 || index > uo->count)
+    {
+    #ifdef DEBUG
+        printf("uolist_split_at: Parameter error\n");
+    #elif defined FILE_DEBUG
+        
+    #endif
+        goto ERR0;        
+    } /* end of if (NULL == uo || index < 0 || index > uo->count) */
+
+    /* 1.创建存储模式相同的链表 */
+    dst = uolist_create_ex(uo->size, uo->my_destroy, uo->flags);
+    if ((void *)FUN_ERROR == dst)
+    {
+        goto ERR1;
+    } /* end of if ((void *)FUN_ERROR == dst) */
+    dst->my_order = uo->my_order;
+
+    /* 2.后半部分为空时直接返回 */
+    if (index == uo->count)
+    {
+        return dst;
+    } /* end of if (index == uo->count) */
+
+    /* 3.后半部分为整个链表时交换节点 */
+    if (0 == index && !(uo->flags & UOLIST_POOL))
+    {
+        __uolist_concat(dst, uo);
+        dst->my_order = uo->my_order;
+        return dst;
+    } /* end of if (0 == index && !(uo->flags & UOLIST_POOL)) */
+
+    /* 展开链表模式 */
+    if (uo->flags & UOLIST_UNROLLED)
+    {
+        if (0 != unrolled_split(uo, index, dst))
+        {
+            goto ERR2;
+        } /* end of if (0 != unrolled_split(uo, index, dst)) */
+        return dst;
+    } /* end of if (uo->flags & UOLIST_UNROLLED) */
+
+    /* 4.定位拆分位置 */
+    prev = __insert_prev(uo, index);
+    temp = (NULL == prev) ? uo->fstnode_p : prev->next;
+
+    /* 5.移动或拷贝后半部分 */
+    if (uo->flags & UOLIST_POOL)
+    {
+        // 节点属于原链表的内存池, 只能拷贝到新链表后释放原节点
+        for (save = temp; NULL != save; save = save->next)
+        {
+            if (0 != __uolist_append(dst, save->data))
+            {
+                // 新链表中的数据为浅拷贝, 只释放其内存池
+                goto ERR2;
+            } /* end of if (0 != __uolist_append(dst, save->data)) */
+        } /* end of for (save = temp; NULL != save; save = save->next) */
+
+        for (; NULL != temp; temp = save)
+        {
+            save = temp->next;
+            // 数据已交给新链表, 只回收节点空间
+            hindex_remove(uo, temp);
+            temp->next = uo->pool.free_list;
+            uo->pool.free_list = temp;
+        } /* end of for (; NULL != temp; temp = save) */
+    }
+    else 
+    {
+        dst->fstnode_p = temp;
+        dst->lstnode_p = uo->lstnode_p;
+        dst->count = uo->count - index;
+        for (; NULL != temp; temp = temp->next)
+        {
+            hindex_remove(uo, temp);
+        } /* end of for (; NULL != temp; temp = temp->next) */
+    }
+
+    /* 6.刷新信息 */
+    if (NULL == prev)
+    {
+        uo->fstnode_p = NULL;
+    }
+    else 
+    {
+        prev->next = NULL;
+    }
+    uo->lstnode_p = prev;
+    uo->count = index;
+    uo->skdirty = 1;
+    dst->skdirty = 1;
+
+    return dst;
+
+ERR0:
+    return (void *)PAR_ERROR;
+ERR1:
+    return (void *)FUN_ERROR;
+ERR2:
+    head_destroy(&dst);
+    return (void *)FUN_ERROR;
+}
+
+
+/**
+ * @brief           加独占锁后调用 __uolist_prepend
+ * @param           同 __uolist_prepend
+ * @return          同 __uolist_prepend
+ */
+int uolist_prepend(uolist_t *uo, void *data)
+{
+    int ret = 0;
+
+    lock_write(uo);
+    ret = __uolist_prepend(uo, data);
+    lock_unlock(uo);
+
+    return ret;
+}
+
+
+/**
+ * @brief           加共享锁后调用 __uolist_traverse
+ * @param           同 __uolist_traverse
+ * @return          同 __uolist_traverse
+ */
+int uolist_traverse(uolist_t *uo, op_t my_print)
+{
+    int ret = 0;
+
+    lock_read(uo);
+    ret = __uolist_traverse(uo, my_print);
+    lock_unlock(uo);
+
+    return ret;
+}
+
+
+/**
+ * @brief           加独占锁后调用 __uolist_destroy
+ * @param           同 __uolist_destroy
+ * @return          同 __uolist_destroy
+ */
+int uolist_destroy(uolist_t *uo)
+{
+    int ret = 0;
+
+    lock_write(uo);
+    ret = __uolist_destroy(uo);
+    lock_unlock(uo);
+
+    return ret;
+}
+
+
+/**
+ * @brief           加共享锁后调用 __get_count
+ * @param           同 __get_count
+ * @return          同 __get_count
+ */
+int get_count(uolist_t *p)
+{
+    int ret = 0;
+
+    lock_read(p);
+    ret = __get_count(p);
+    lock_unlock(p);
+
+    return ret;
+}
+
+
+/**
+ * @brief           加独占锁后调用 __uolist_append
+ * @param           同 __uolist_append
+ * @return          同 __uolist_append
+ */
+int uolist_append(uolist_t *uo, void *data)
+{
+    int ret = 0;
+
+    lock_write(uo);
+    ret = __uolist_append(uo, data);
+    lock_unlock(uo);
+
+    return ret;
+}
+
+
+/**
+ * @brief           加独占锁后调用 __uolist_insert_by_index
+ * @param           同 __uolist_insert_by_index
+ * @return          同 __uolist_insert_by_index
+ */
+int uolist_insert_by_index(uolist_t *uo, void *data, int index)
+{
+    int ret = 0;
+
+    lock_write(uo);
+    ret = __uolist_insert_by_index(uo, data, index);
+    lock_unlock(uo);
+
+    return ret;
+}
+
+
+/**
+ * @brief           加独占锁后调用 __uolist_delete_by_index
+ * @param           同 __uolist_delete_by_index
+ * @return          同 __uolist_delete_by_index
+ */
+int uolist_delete_by_index(uolist_t *uo, int index)
+{
+    int ret = 0;
+
+    lock_write(uo);
+    ret = __uolist_delete_by_index(uo, index);
+    lock_unlock(uo);
+
+    return ret;
+}
+
+
+/**
+ * @brief           加独占锁后调用 __uolist_modify_by_index
+ * @param           同 __uolist_modify_by_index
+ * @return          同 __uolist_modify_by_index
+ */
+int uolist_modify_by_index(uolist_t *uo, void *data, int index)
+{
+    int ret = 0;
+
+    lock_write(uo);
+    ret = __uolist_modify_by_index(uo, data, index);
+    lock_unlock(uo);
+
+    return ret;
+}
+
+
+/**
+ * @brief           加共享锁后调用 __uolist_retrieve_by_index
+ * @param           同 __uolist_retrieve_by_index
+ * @return          同 __uolist_retrieve_by_index
+ */
+int uolist_retrieve_by_index(uolist_t *uo, void *data, int index)
+{
+    int ret = 0;
+
+    lock_read(uo);
+    ret = __uolist_retrieve_by_index(uo, data, index);
+    lock_unlock(uo);
+
+    return ret;
+}
+
+
+/**
+ * @brief           加共享锁后调用 __get_match_index
+ * @param           同 __get_match_index
+ * @return          同 __get_match_index
+ */
+int get_match_index(uolist_t *uo, void *key, cmp_t op_cmp)
+{
+    int ret = 0;
+
+    lock_read(uo);
+    ret = __get_match_index(uo, key, op_cmp);
+    lock_unlock(uo);
+
+    return ret;
+}
+
+
+/**
+ * @brief           加独占锁后调用 __uolist_delete_by_key
+ * @param           同 __uolist_delete_by_key
+ * @return          同 __uolist_delete_by_key
+ */
+int uolist_delete_by_key(uolist_t *uo, void *key, cmp_t op_cmp)
+{
+    int ret = 0;
+
+    lock_write(uo);
+    ret = __uolist_delete_by_key(uo, key, op_cmp);
+    lock_unlock(uo);
+
+    return ret;
+}
+
+
+/**
+ * @brief           加独占锁后调用 __uolist_modify_by_key
+ * @param           同 __uolist_modify_by_key
+ * @return          同 __uolist_modify_by_key
+ */
+int uolist_modify_by_key(uolist_t *uo, void *data, void *key, cmp_t op_cmp)
+{
+    int ret = 0;
+
+    lock_write(uo);
+    ret = __uolist_modify_by_key(uo, data, key, op_cmp);
+    lock_unlock(uo);
+
+    return ret;
+}
+
+
+/**
+ * @brief           加共享锁后调用 __uolist_retrieve_by_key
+ * @param           同 __uolist_retrieve_by_key
+ * @return          同 __uolist_retrieve_by_key
+ */
+int uolist_retrieve_by_key(uolist_t *uo, void *data, void *key, cmp_t op_cmp)
+{
+    int ret = 0;
+
+    lock_read(uo);
+    ret = __uolist_retrieve_by_key(uo, data, key, op_cmp);
+    lock_unlock(uo);
+
+    return ret;
+}
+
+
+/**
+ * @brief           加独占锁后调用 __uolist_delete_all_by_key
+ * @param           同 __uolist_delete_all_by_key
+ * @return          同 __uolist_delete_all_by_key
+ */
+int uolist_delete_all_by_key(uolist_t *uo, void *key, cmp_t op_cmp)
+{
+    int ret = 0;
+
+    lock_write(uo);
+    ret = __uolist_delete_all_by_key(uo, key, op_cmp);
+    lock_unlock(uo);
+
+    return ret;
+}
+
+
+/**
+ * @brief           加独占锁后调用 __uolist_modify_all_by_key
+ * @param           同 __uolist_modify_all_by_key
+ * @return          同 __uolist_modify_all_by_key
+ */
+int uolist_modify_all_by_key(uolist_t *uo, void *data, void *key, cmp_t op_cmp)
+{
+    int ret = 0;
+
+    lock_write(uo);
+    ret = __uolist_modify_all_by_key(uo, data, key, op_cmp);
+    lock_unlock(uo);
+
+    return ret;
+}
+
+
+/**
+ * @brief           加独占锁后调用 __uolist_update_all_by_key
+ * @param           同 __uolist_update_all_by_key
+ * @return          同 __uolist_update_all_by_key
+ */
+int uolist_update_all_by_key(uolist_t *uo, void *key, cmp_t op_cmp, op_t my_update)
+{
+    int ret = 0;
+
+    lock_write(uo);
+    ret = __uolist_update_all_by_key(uo, key, op_cmp, my_update);
+    lock_unlock(uo);
+
+    return ret;
+}
+
+
+/**
+ * @brief           加共享锁后调用 __uolist_find_all_index_by_key
+ * @param           同 __uolist_find_all_index_by_key
+ * @return          同 __uolist_find_all_index_by_key
+ */
+uolist_t *uolist_find_all_index_by_key(uolist_t *uo, void *key, cmp_t op_cmp)
+{
+    uolist_t *ret = NULL;
+
+    lock_read(uo);
+    ret = __uolist_find_all_index_by_key(uo, key, op_cmp);
+    lock_unlock(uo);
+
+    return ret;
+}
+
+
+/**
+ * @brief           加独占锁后调用 __uolist_reverse
+ * @param           同 __uolist_reverse
+ * @return          同 __uolist_reverse
+ */
+int uolist_reverse(uolist_t *uo)
+{
+    int ret = 0;
+
+    lock_write(uo);
+    ret = __uolist_reverse(uo);
+    lock_unlock(uo);
+
+    return ret;
+}
+
+
+/**
+ * @brief           加独占锁后调用 __uolist_append_bulk
+ * @param           同 __uolist_append_bulk
+ * @return          同 __uolist_append_bulk
+ */
+int uolist_append_bulk(uolist_t *uo, void *data, int n)
+{
+    int ret = 0;
+
+    lock_write(uo);
+    ret = __uolist_append_bulk(uo, data, n);
+    lock_unlock(uo);
+
+    return ret;
+}
+
+
+/**
+ * @brief           加独占锁后调用 __uolist_prepend_bulk
+ * @param           同 __uolist_prepend_bulk
+ * @return          同 __uolist_prepend_bulk
+ */
+int uolist_prepend_bulk(uolist_t *uo, void *data, int n)
+{
+    int ret = 0;
+
+    lock_write(uo);
+    ret = __uolist_prepend_bulk(uo, data, n);
+    lock_unlock(uo);
+
+    return ret;
+}
+
+
+/**
+ * @brief           加共享锁后调用 __uolist_to_array
+ * @param           同 __uolist_to_array
+ * @return          同 __uolist_to_array
+ */
+void *uolist_to_array(uolist_t *uo, void *buf, int prefetch)
+{
+    void *ret = NULL;
+
+    lock_read(uo);
+    ret = __uolist_to_array(uo, buf, prefetch);
+    lock_unlock(uo);
+
+    return ret;
+}
+
+
+/**
+ * @brief           加独占锁后调用 __uolist_hash_attach
+ * @param           同 __uolist_hash_attach
+ * @return          同 __uolist_hash_attach
+ */
+int uolist_hash_attach(uolist_t *uo, hash_t my_hash, cmp_t op_cmp)
+{
+    int ret = 0;
+
+    lock_write(uo);
+    ret = __uolist_hash_attach(uo, my_hash, op_cmp);
+    lock_unlock(uo);
+
+    return ret;
+}
+
+
+/**
+ * @brief           加独占锁后调用 __uolist_hash_detach
+ * @param           同 __uolist_hash_detach
+ * @return          同 __uolist_hash_detach
+ */
+int uolist_hash_detach(uolist_t *uo)
+{
+    int ret = 0;
+
+    lock_write(uo);
+    ret = __uolist_hash_detach(uo);
+    lock_unlock(uo);
+
+    return ret;
+}
+
+
+/**
+ * @brief           加独占锁后调用 __uolist_set_order
+ * @param           同 __uolist_set_order
+ * @return          同 __uolist_set_order
+ */
+int uolist_set_order(uolist_t *uo, order_t my_order)
+{
+    int ret = 0;
+
+    lock_write(uo);
+    ret = __uolist_set_order(uo, my_order);
+    lock_unlock(uo);
+
+    return ret;
+}
+
+
+/**
+ * @brief           加独占锁后调用 __uolist_insert_sorted
+ * @param           同 __uolist_insert_sorted
+ * @return          同 __uolist_insert_sorted
+ */
+int uolist_insert_sorted(uolist_t *uo, void *data)
+{
+    int ret = 0;
+
+    lock_write(uo);
+    ret = __uolist_insert_sorted(uo, data);
+    lock_unlock(uo);
+
+    return ret;
+}
+
+
+/**
+ * @brief           加共享锁后调用 __uolist_find_sorted
+ * @param           同 __uolist_find_sorted
+ * @return          同 __uolist_find_sorted
+ */
+int uolist_find_sorted(uolist_t *uo, void *key)
+{
+    int ret = 0;
+
+    lock_read(uo);
+    ret = __uolist_find_sorted(uo, key);
+    lock_unlock(uo);
+
+    return ret;
+}
+
+
+/**
+ * @brief           加共享锁后调用 __uolist_retrieve_sorted
+ * @param           同 __uolist_retrieve_sorted
+ * @return          同 __uolist_retrieve_sorted
+ */
+int uolist_retrieve_sorted(uolist_t *uo, void *data, void *key)
+{
+    int ret = 0;
+
+    lock_read(uo);
+    ret = __uolist_retrieve_sorted(uo, data, key);
+    lock_unlock(uo);
+
+    return ret;
+}
+
+
+/**
+ * @brief           加独占锁后调用 __uolist_delete_sorted
+ * @param           同 __uolist_delete_sorted
+ * @return          同 __uolist_delete_sorted
+ */
+int uolist_delete_sorted(uolist_t *uo, void *key)
+{
+    int ret = 0;
+
+    lock_write(uo);
+    ret = __uolist_delete_sorted(uo, key);
+    lock_unlock(uo);
+
+    return ret;
+}
+
+
+/**
+ * @brief           加独占锁后调用 __uolist_sort
+ * @param           同 __uolist_sort
+ * @return          同 __uolist_sort
+ */
+int uolist_sort(uolist_t *uo, order_t my_order)
+{
+    int ret = 0;
+
+    lock_write(uo);
+    ret = __uolist_sort(uo, my_order);
+    lock_unlock(uo);
+
+    return ret;
+}
+
+
+/**
+ * @brief           加独占锁后调用 __uolist_radix_sort
+ * @param           同 __uolist_radix_sort
+ * @return          同 __uolist_radix_sort
+ */
+int uolist_radix_sort(uolist_t *uo, radix_t my_key)
+{
+    int ret = 0;
+
+    lock_write(uo);
+    ret = __uolist_radix_sort(uo, my_key);
+    lock_unlock(uo);
+
+    return ret;
+}
+
+
+/**
+ * @brief           加独占锁后调用 __uolist_parallel_sort
+ * @param           同 __uolist_parallel_sort
+ * @return          同 __uolist_parallel_sort
+ */
+int uolist_parallel_sort(uolist_t *uo, order_t my_order, int nthreads)
+{
+    int ret = 0;
+
+    lock_write(uo);
+    ret = __uolist_parallel_sort(uo, my_order, nthreads);
+    lock_unlock(uo);
+
+    return ret;
+}
+
+
+/**
+ * @brief           加独占锁后调用 __uolist_concat
+ * @details         按地址顺序对两个链表加锁, 避免相互拼接时死锁
+ * @param           同 __uolist_concat
+ * @return          同 __uolist_concat
+ */
+int uolist_concat(uolist_t *dst, uolist_t *src)
+{
+    int ret = 0;
+
+    if ((char *)dst < (char *)src)
+    {
+        lock_write(dst);
+        lock_write(src);
+    }
+    else if (dst != src)
+    {
+        lock_write(src);
+        lock_write(dst);
+    } /* end of if ((char *)dst < (char *)src) */
+    ret = __uolist_concat(dst, src);
+    if (dst != src)
+    {
+        lock_unlock(src);
+        lock_unlock(dst);
+    } /* end of if (dst != src) */
+
+    return ret;
+}
+
+
+/**
+ * @brief           加独占锁后调用 __uolist_split_at
+ * @param           同 __uolist_split_at
+ * @return          同 __uolist_split_at
+ */
+uolist_t *uolist_split_at(uolist_t *uo, int index)
+{
+    uolist_t *ret = NULL;
+
+    lock_write(uo);
+    ret = __uolist_split_at(uo, index);
+    lock_unlock(uo);
+
+    return ret;
+}
+
+
+/**
+ * @brief           对链表加共享锁
+ * @details         持有期间可调用游标的只读函数及借用函数, 不能调用其他加锁的链表函数.
+ *                  非 UOLIST_CONCURRENT 模式下直接返回
+ * @param           头信息结构体的指针
+ * @return          
+ *      @arg  0:正常
+ *      @arg  PAR_ERROR:参数错误
+ */
+int uolist_lock_read(uolist_t *uo)
+{
+    /* 参数检查 */
+    if (NULL == uo)
+    {
+    #ifdef DEBUG
+        printf("uolist_lock_read: Parameter error\n");
+    #elif defined FILE_DEBUG
+        
+    #endif
+        goto ERR0;        
+    } /* end of if (NULL == uo) */
+
+    return lock_read(uo);
+
+ERR0:
+    return PAR_ERROR;
+}
+
+
+/**
+ * @brief           对链表加独占锁
+ * @details         持有期间可调用游标、借用及原地构造函数, 不能调用其他加锁的链表函数.
+ *                  非 UOLIST_CONCURRENT 模式下直接返回
+ * @param           头信息结构体的指针
+ * @return          
+ *      @arg  0:正常
+ *      @arg  PAR_ERROR:参数错误
+ */
+int uolist_lock_write(uolist_t *uo)
+{
+    /* 参数检查 */
+    if (NULL == uo)
+    {
+    #ifdef DEBUG
+        printf("uolist_lock_write: Parameter error\n");
+    #elif defined FILE_DEBUG
+        
+    #endif
+        goto ERR0;        
+    } /* end of if (NULL == uo) */
+
+    return lock_write(uo);
+
+ERR0:
+    return PAR_ERROR;
+}
+
+
+/**
+ * @brief           释放 uolist_lock_read / uolist_lock_write 所加的锁
+ * @details         释放独占锁前重建失效的跳表及哈希索引, 之后的读操作可同时进行
+ * @param           头信息结构体的指针
+ * @return          
+ *      @arg  0:正常
+ *      @arg  PAR_ERROR:参数错误
+ */
+int uolist_unlock(uolist_t *uo)
+{
+    /* 参数检查 */
+    if (NULL == uo)
+    {
+    #ifdef DEBUG
+        printf("uolist_unlock: Parameter error\n");
+    #elif defined FILE_DEBUG
+        
+    #endif
+        goto ERR0;        
+    } /* end of if (NULL == uo) */
+
+    return lock_unlock(uo);
+
+ERR0:
+    return PAR_ERROR;
 }
 
 
@@ -0,0 +1,100 @@
+/**
+ * @file                uolist_hash.h
+ * @brief               万能型单向链表的哈希索引
+ * @details             供 uni_oneway_linkedlist.c 在附加哈希索引后调用,
+ *                      未附加索引(hidx 为 NULL)时各函数直接返回
+ * @author              BHR
+ * @version             v1.2
+ * @date                2026-10-16
+ * @copyright           MIT
+ */
+
+#ifndef __UOLIST_HASH_H__
+#define __UOLIST_HASH_H__
+
+#include "uni_oneway_linkedlist.h"
+
+
+/**
+ * @brief           创建哈希索引(索引处于失效状态, 首次查找时建立)
+ * @param           头信息结构体的指针
+ * @param           自定义哈希函数
+ * @param           与哈希函数配套的比较函数
+ * @return
+ *      @arg  0:正常
+ *      @arg  FUN_ERROR:函数错误
+ */
+int hindex_attach(uolist_t *uo, hash_t my_hash, cmp_t op_cmp);
+
+
+/**
+ * @brief           释放哈希索引
+ * @param           头信息结构体的指针
+ * @return          0
+ */
+int hindex_release(uolist_t *uo);
+
+
+/**
+ * @brief           释放全部表项, 并使索引失效
+ * @param           头信息结构体的指针
+ * @return          0
+ */
+int hindex_clear(uolist_t *uo);
+
+
+/**
+ * @brief           使索引失效(数据可能已被改写)
+ * @param           头信息结构体的指针
+ * @return          0
+ */
+int hindex_invalidate(uolist_t *uo);
+
+
+/**
+ * @brief           索引失效时根据链表重建索引
+ * @param           头信息结构体的指针
+ * @return
+ *      @arg  0:正常(或未附加索引)
+ *      @arg  FUN_ERROR:函数错误(索引仍为失效状态)
+ */
+int hindex_sync(uolist_t *uo);
+
+
+/**
+ * @brief           为新连接的链表节点添加表项
+ * @param           头信息结构体的指针
+ * @param           链表节点(数据已写入)
+ * @return          0
+ */
+int hindex_insert(uolist_t *uo, node_t *p);
+
+
+/**
+ * @brief           删除链表节点对应的表项(须在改写或释放数据之前调用)
+ * @param           头信息结构体的指针
+ * @param           链表节点
+ * @return          0
+ */
+int hindex_remove(uolist_t *uo, node_t *p);
+
+
+/**
+ * @brief           通过哈希索引查找第一个匹配的节点
+ * @param           头信息结构体的指针
+ * @param           关键字
+ * @param           自定义比较函数
+ * @param           保存匹配节点的指针(无匹配时为 NULL)
+ * @param           保存匹配节点前驱的指针, 可为 NULL
+ * @param           保存匹配节点索引的指针, 可为 NULL
+ * @return
+ *      @arg  0:查找完成
+ *      @arg  FUN_ERROR:索引不可用, 调用者需遍历链表
+ */
+int hindex_find(uolist_t *uo, void *key, cmp_t op_cmp, node_t **node, node_t **prev, int *index);
+
+
+
+
+#endif /* __UOLIST_HASH_H__ */
+
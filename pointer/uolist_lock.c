@@ -0,0 +1,186 @@
+/**
+ * @file                uolist_lock.c
+ * @brief               万能型单向链表的读写锁
+ * @details             只读函数加共享锁, 可在多个线程中同时执行; 修改链表的函数加独占锁.
+ *                      跳表及哈希索引在读操作中按需重建, 重建期间须独占访问, 因此释放
+ *                      独占锁之前先重建失效的索引, 读操作始终只需共享锁
+ * @author              BHR
+ * @version             v1.2
+ * @date                2026-10-16
+ * @copyright           MIT
+ */
+
+#include "uolist_lock.h"
+#include "uolist_skiplist.h"
+#include "uolist_hash.h"
+
+
+/**
+ * @brief           判断读操作是否可能重建索引
+ * @param           链表头信息结构体指针
+ * @return          1:可能重建, 0:不会重建
+ */
+static int __index_dirty(uolist_t *uo)
+{
+    if ((uo->flags & UOLIST_SKIPLIST) && uo->skdirty)
+    {
+        return 1;
+    } /* end of if ((uo->flags & UOLIST_SKIPLIST) && uo->skdirty) */
+
+    // 持有共享锁时仍可能有线程违规借用可写数据使哈希索引失效, 原子读取
+    if (NULL != uo->hidx && __atomic_load_n(&uo->hidx->dirty, __ATOMIC_RELAXED))
+    {
+        return 1;
+    } /* end of if (NULL != uo->hidx && __atomic_load_n(&uo->hidx->dirty, __ATOMIC_RELAXED)) */
+
+    return 0;
+}
+
+
+/**
+ * @brief           重建失效的跳表及哈希索引
+ * @param           链表头信息结构体指针
+ * @return          无
+ */
+static void __index_sync(uolist_t *uo)
+{
+    if ((uo->flags & UOLIST_SKIPLIST) && uo->skdirty)
+    {
+        skiplist_sync(uo);
+    } /* end of if ((uo->flags & UOLIST_SKIPLIST) && uo->skdirty) */
+
+    // 重建失败时索引仍为失效状态, 之后的读操作改加独占锁
+    hindex_sync(uo);
+}
+
+
+
+/**
+ * @brief           创建读写锁
+ * @param           头信息结构体的指针
+ * @return
+ *      @arg  0:正常
+ *      @arg  FUN_ERROR:函数错误
+ */
+int lock_init(uolist_t *uo)
+{
+    pthread_rwlock_t *lock = NULL;
+
+    lock = (pthread_rwlock_t *)malloc(sizeof(pthread_rwlock_t));
+    if (NULL == lock)
+    {
+    #ifdef DEBUG
+        printf("lock_init: malloc error\n");
+    #elif defined FILE_DEBUG
+
+    #endif
+        goto ERR1;
+    } /* end of if (NULL == lock) */
+
+    if (0 != pthread_rwlock_init(lock, NULL))
+    {
+    #ifdef DEBUG
+        printf("lock_init: pthread_rwlock_init error\n");
+    #elif defined FILE_DEBUG
+
+    #endif
+        goto ERR2;
+    } /* end of if (0 != pthread_rwlock_init(lock, NULL)) */
+
+    uo->lock = lock;
+
+    return 0;
+
+ERR2:
+    free(lock);
+ERR1:
+    return FUN_ERROR;
+}
+
+
+/**
+ * @brief           销毁读写锁
+ * @param           头信息结构体的指针
+ * @return          0
+ */
+int lock_release(uolist_t *uo)
+{
+    if (NULL != uo->lock)
+    {
+        pthread_rwlock_destroy(uo->lock);
+        free(uo->lock);
+        uo->lock = NULL;
+    } /* end of if (NULL != uo->lock) */
+
+    return 0;
+}
+
+
+/**
+ * @brief           加共享锁
+ * @details         索引在释放独占锁前已经重建; 只有重建失败、索引仍失效时改加独占锁
+ * @param           头信息结构体的指针(可为 NULL)
+ * @return          0
+ */
+int lock_read(uolist_t *uo)
+{
+    if (NULL == uo || NULL == uo->lock)
+    {
+        return 0;
+    } /* end of if (NULL == uo || NULL == uo->lock) */
+
+    pthread_rwlock_rdlock(uo->lock);
+
+    // 改加独占锁后同样记录持有方式, 解锁前重建索引
+    if (__index_dirty(uo))
+    {
+        pthread_rwlock_unlock(uo->lock);
+        pthread_rwlock_wrlock(uo->lock);
+        uo->wrheld = 1;
+    } /* end of if (__index_dirty(uo)) */
+
+    return 0;
+}
+
+
+/**
+ * @brief           加独占锁
+ * @param           头信息结构体的指针(可为 NULL)
+ * @return          0
+ */
+int lock_write(uolist_t *uo)
+{
+    if (NULL != uo && NULL != uo->lock)
+    {
+        pthread_rwlock_wrlock(uo->lock);
+        uo->wrheld = 1;
+    } /* end of if (NULL != uo && NULL != uo->lock) */
+
+    return 0;
+}
+
+
+/**
+ * @brief           解锁
+ * @details         释放独占锁前重建失效的跳表及哈希索引, 持有共享锁时不重建
+ * @param           头信息结构体的指针(可为 NULL)
+ * @return          0
+ */
+int lock_unlock(uolist_t *uo)
+{
+    if (NULL != uo && NULL != uo->lock)
+    {
+        // 只有持有独占锁时才能重建索引(共享锁期间 wrheld 不会改变)
+        if (uo->wrheld)
+        {
+            if (__index_dirty(uo))
+            {
+                __index_sync(uo);
+            } /* end of if (__index_dirty(uo)) */
+            uo->wrheld = 0;
+        } /* end of if (uo->wrheld) */
+        pthread_rwlock_unlock(uo->lock);
+    } /* end of if (NULL != uo && NULL != uo->lock) */
+
+    return 0;
+}
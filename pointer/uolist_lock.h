@@ -0,0 +1,65 @@
+/**
+ * @file                uolist_lock.h
+ * @brief               万能型单向链表的读写锁
+ * @details             供 uni_oneway_linkedlist.c 在 UOLIST_CONCURRENT 模式下调用,
+ *                      未附加读写锁(lock 为 NULL)时各函数直接返回
+ * @author              BHR
+ * @version             v1.2
+ * @date                2026-10-16
+ * @copyright           MIT
+ */
+
+#ifndef __UOLIST_LOCK_H__
+#define __UOLIST_LOCK_H__
+
+#include "uni_oneway_linkedlist.h"
+
+
+/**
+ * @brief           创建读写锁
+ * @param           头信息结构体的指针
+ * @return
+ *      @arg  0:正常
+ *      @arg  FUN_ERROR:函数错误
+ */
+int lock_init(uolist_t *uo);
+
+
+/**
+ * @brief           销毁读写锁
+ * @param           头信息结构体的指针
+ * @return          0
+ */
+int lock_release(uolist_t *uo);
+
+
+/**
+ * @brief           加共享锁
+ * @details         索引在释放独占锁前已经重建; 只有重建失败、索引仍失效时改加独占锁
+ * @param           头信息结构体的指针(可为 NULL)
+ * @return          0
+ */
+int lock_read(uolist_t *uo);
+
+
+/**
+ * @brief           加独占锁
+ * @param           头信息结构体的指针(可为 NULL)
+ * @return          0
+ */
+int lock_write(uolist_t *uo);
+
+
+/**
+ * @brief           解锁
+ * @details         释放独占锁前重建失效的跳表及哈希索引, 持有共享锁时不重建
+ * @param           头信息结构体的指针(可为 NULL)
+ * @return          0
+ */
+int lock_unlock(uolist_t *uo);
+
+
+
+
+#endif /* __UOLIST_LOCK_H__ */
+
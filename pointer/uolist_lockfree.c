@@ -0,0 +1,664 @@
+/**
+ * @file                uolist_lockfree.c
+ * @brief               无锁有序单向链表(Harris 算法)
+ * @details             节点指针域最低位为删除标记: 标记后的节点不再接受插入
+ *                      (CAS 的期望值不含标记), 也不会被再次删除.
+ *                      摘除节点的 CAS 以前驱指针域为目标, 前驱已被标记时 CAS 失败,
+ *                      从头重新查找. 节点的回收方式由 flags 选择, 各函数通过
+ *                      __lf_enter / __lf_protect / __lf_retire / __lf_exit 访问节点,
+ *                      纪元回收方式下 __lf_protect 不做任何操作.
+ *                      原子操作使用 GCC __atomic 内建函数
+ * @author              BHR
+ * @version             v1.2
+ * @date                2026-10-16
+ * @copyright           MIT
+ */
+
+#include "uolist_lockfree.h"
+#include "uolist_epoch.h"
+#include "uolist_hazard.h"
+
+
+/**
+ * @brief           判断指针是否带有删除标记
+ * @param           指针域的值
+ * @return          1:已标记, 0:未标记
+ */
+static int __is_marked(lfnode_t *p)
+{
+    return (int)((uintptr_t)p & 1);
+}
+
+
+/**
+ * @brief           为指针加上删除标记
+ * @param           指针域的值
+ * @return          带标记的指针
+ */
+static lfnode_t *__mark(lfnode_t *p)
+{
+    return (lfnode_t *)((uintptr_t)p | 1);
+}
+
+
+/**
+ * @brief           去掉指针的删除标记
+ * @param           指针域的值
+ * @return          不带标记的指针
+ */
+static lfnode_t *__unmark(lfnode_t *p)
+{
+    return (lfnode_t *)((uintptr_t)p & ~(uintptr_t)1);
+}
+
+
+/**
+ * @brief           释放节点
+ * @param           链表头信息结构体指针
+ * @param           节点
+ * @return          无
+ */
+static void __lf_free(lflist_t *lf, lfnode_t *p)
+{
+    if (NULL != lf->my_destroy)
+    {
+        lf->my_destroy(p->data);
+    } /* end of if (NULL != lf->my_destroy) */
+    free(p);
+}
+
+
+/**
+ * @brief           开始访问链表
+ * @param           链表头信息结构体指针
+ * @return          当前线程的回收记录, 失败返回 NULL
+ */
+static void *__lf_enter(lflist_t *lf)
+{
+    if (lf->flags & LFLIST_HAZARD)
+    {
+        return hazard_enter(lf);
+    } /* end of if (lf->flags & LFLIST_HAZARD) */
+
+    return epoch_enter(&lf->ebr);
+}
+
+
+/**
+ * @brief           结束访问链表
+ * @param           链表头信息结构体指针
+ * @param           当前线程的回收记录
+ * @return          无
+ */
+static void __lf_exit(lflist_t *lf, void *rec)
+{
+    if (lf->flags & LFLIST_HAZARD)
+    {
+        hazard_exit((hazard_rec_t *)rec);
+        return;
+    } /* end of if (lf->flags & LFLIST_HAZARD) */
+
+    epoch_exit((epoch_rec_t *)rec);
+}
+
+
+/**
+ * @brief           保护将要访问的节点
+ * @param           链表头信息结构体指针
+ * @param           当前线程的回收记录
+ * @param           风险指针序号(0:前驱, 1:当前节点)
+ * @param           要访问的节点
+ * @param           指向该节点的指针域的地址(为 NULL 表示节点已受保护, 不确认)
+ * @return          0:节点受保护, FUN_ERROR:需从头重新查找
+ */
+static int __lf_protect(lflist_t *lf, void *rec, int slot, lfnode_t *p, lfnode_t **pp)
+{
+    if (lf->flags & LFLIST_HAZARD)
+    {
+        return hazard_protect((hazard_rec_t *)rec, slot, p, pp);
+    } /* end of if (lf->flags & LFLIST_HAZARD) */
+
+    // 纪元回收方式下临界区中读取到的节点都不会被释放
+    return 0;
+}
+
+
+/**
+ * @brief           回收已摘除的节点
+ * @param           链表头信息结构体指针
+ * @param           当前线程的回收记录
+ * @param           已摘除的节点
+ * @return          无
+ */
+static void __lf_retire(lflist_t *lf, void *rec, lfnode_t *p)
+{
+    if (lf->flags & LFLIST_HAZARD)
+    {
+        hazard_retire(lf, (hazard_rec_t *)rec, p);
+        return;
+    } /* end of if (lf->flags & LFLIST_HAZARD) */
+
+    epoch_retire(&lf->ebr, (epoch_rec_t *)rec, p);
+}
+
+
+/**
+ * @brief           查找位置, 沿途摘除已标记删除的节点
+ * @details         返回时前驱节点及定位到的节点均受保护
+ * @param           链表头信息结构体指针
+ * @param           当前线程的回收记录
+ * @param           关键字
+ * @param           自定义比较函数(为 NULL 时定位插入位置, 即第一个大于关键字的节点)
+ * @param           保存指向返回节点的指针域的地址
+ * @param           保存定位到的节点(可能为 NULL)
+ * @return          1:定位到匹配节点, 0:无匹配节点
+ */
+static int __lf_search(lflist_t *lf, void *rec, void *key, cmp_t op_cmp, lfnode_t ***prev, lfnode_t **cur)
+{
+    lfnode_t **pp = NULL;
+    lfnode_t *p = NULL;
+    lfnode_t *next = NULL;
+    int ret = 0;
+
+retry:
+    pp = &lf->head;
+    p = __atomic_load_n(pp, __ATOMIC_ACQUIRE);
+    while (NULL != p)
+    {
+        /* 1.保护当前节点, 前驱已改变或已被标记时从头查找 */
+        if (0 != __lf_protect(lf, rec, 1, p, pp))
+        {
+            goto retry;
+        } /* end of if (0 != __lf_protect(lf, rec, 1, p, pp)) */
+        next = __atomic_load_n(&p->next, __ATOMIC_ACQUIRE);
+
+        /* 2.摘除已标记删除的节点, 前驱已改变时从头查找 */
+        if (__is_marked(next))
+        {
+            next = __unmark(next);
+            if (!__atomic_compare_exchange_n(pp, &p, next, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+            {
+                goto retry;
+            } /* end of if (!__atomic_compare_exchange_n(pp, &p, next, ...)) */
+            __lf_retire(lf, rec, p);
+            p = next;
+            continue;
+        } /* end of if (__is_marked(next)) */
+
+        /* 3.比较节点数据与关键字 */
+        ret = lf->my_order(p->data, key);
+        if (ret > 0)
+        {
+            break;
+        } /* end of if (ret > 0) */
+        if (0 == ret && NULL != op_cmp && MATCH_SUCCESS == op_cmp(p->data, key))
+        {
+            *prev = pp;
+            *cur = p;
+            return 1;
+        } /* end of if (0 == ret && NULL != op_cmp && ...) */
+
+        /* 4.当前节点成为前驱 */
+        __lf_protect(lf, rec, 0, p, NULL);
+        pp = &p->next;
+        p = next;
+    } /* end of while (NULL != p) */
+
+    *prev = pp;
+    *cur = p;
+
+    return 0;
+}
+
+
+
+/**
+ * @brief           创建无锁链表头信息结构体(纪元回收)
+ * @param           存储数据类型大小
+ * @param           自定义销毁数据函数(只释放数据内部引用的资源, 可为 NULL)
+ * @param           三路比较函数(数据小于/等于/大于关键字时返回负数/0/正数)
+ * @return          指向链表头信息结构体的指针
+ *      @arg  PAR_ERROR:参数错误
+ *      @arg  FUN_ERROR:函数错误
+ */
+lflist_t *lflist_create(int size, op_t my_destroy, order_t my_order)
+{
+    return lflist_create_ex(size, my_destroy, my_order, LFLIST_EPOCH);
+}
+
+
+/**
+ * @brief           按指定回收方式创建无锁链表头信息结构体
+ * @param           存储数据类型大小
+ * @param           自定义销毁数据函数(只释放数据内部引用的资源, 可为 NULL)
+ * @param           三路比较函数(数据小于/等于/大于关键字时返回负数/0/正数)
+ * @param           回收方式(LFLIST_EPOCH / LFLIST_HAZARD)
+ * @return          指向链表头信息结构体的指针
+ *      @arg  PAR_ERROR:参数错误
+ *      @arg  FUN_ERROR:函数错误
+ */
+lflist_t *lflist_create_ex(int size, op_t my_destroy, order_t my_order, int flags)
+{
+    lflist_t *lf = NULL;
+
+    /* 参数检查 */
+    if (size <= 0 || NULL == my_order)
+    {
+    #ifdef DEBUG
+        printf("lflist_create_ex: Parameter error\n");
+    #elif defined FILE_DEBUG
+        
+    #endif
+        goto ERR0;
+    } /* end of if (size <= 0 || NULL == my_order) */
+
+    lf = (lflist_t *)calloc(1, sizeof(lflist_t));
+    if (NULL == lf)
+    {
+    #ifdef DEBUG
+        printf("lflist_create_ex: calloc error\n");
+    #elif defined FILE_DEBUG
+        
+    #endif
+        goto ERR1;
+    } /* end of if (NULL == lf) */
+
+    lf->head = NULL;
+    lf->size = size;
+    lf->count = 0;
+    lf->my_destroy = my_destroy;
+    lf->my_order = my_order;
+    lf->flags = flags;
+    epoch_init(&lf->ebr, my_destroy);
+    hazard_init(lf);
+
+    return lf;
+
+ERR0:
+    return (void *)PAR_ERROR;
+ERR1:
+    return (void *)FUN_ERROR;
+}
+
+
+/**
+ * @brief           销毁链表及头信息结构体
+ * @details         须在其他线程不再访问链表后调用
+ * @param           头信息结构体的指针的地址
+ * @return          
+ *      @arg  0:正常
+ *      @arg  PAR_ERROR:参数错误
+ */
+int lflist_destroy(lflist_t **p)
+{
+    lfnode_t *temp = NULL;
+    lfnode_t *save = NULL;
+
+    /* 参数检查 */
+    if (NULL == p || NULL == *p)
+    {
+    #ifdef DEBUG
+        printf("lflist_destroy: Parameter error\n");
+    #elif defined FILE_DEBUG
+        
+    #endif
+        goto ERR0;
+    } /* end of if (NULL == p || NULL == *p) */
+
+    /* 1.释放链表中的节点(包括已标记但未摘除的节点) */
+    for (temp = (*p)->head; NULL != temp; temp = save)
+    {
+        save = __unmark(temp->next);
+        __lf_free(*p, temp);
+    } /* end of for (temp = (*p)->head; NULL != temp; temp = save) */
+
+    /* 2.释放已摘除的节点 */
+    epoch_release(&(*p)->ebr);
+    hazard_release(*p);
+
+    free(*p);
+    *p = NULL;
+
+    return 0;
+
+ERR0:
+    return PAR_ERROR;
+}
+
+
+/**
+ * @brief           有序插入(插入到相等数据之后)
+ * @param           头信息结构体的指针
+ * @param           插入的数据
+ * @return          
+ *      @arg  0:正常
+ *      @arg  PAR_ERROR:参数错误
+ *      @arg  FUN_ERROR:函数错误
+ */
+int lflist_insert(lflist_t *lf, void *data)
+{
+    void *rec = NULL;
+    lfnode_t *node = NULL;
+    lfnode_t **prev = NULL;
+    lfnode_t *cur = NULL;
+
+    /* 参数检查 */
+    if (NULL == lf || NULL == data)
+    {
+    #ifdef DEBUG
+        printf("lflist_insert: Parameter error\n");
+    #elif defined FILE_DEBUG
+        
+    #endif
+        goto ERR0;
+    } /* end of if (NULL == lf || NULL == data) */
+
+    /* 1.创建节点并写入数据(发布前其他线程不可见) */
+    node = (lfnode_t *)malloc(sizeof(lfnode_t) + lf->size);
+    if (NULL == node)
+    {
+    #ifdef DEBUG
+        printf("lflist_insert: malloc error\n");
+    #elif defined FILE_DEBUG
+        
+    #endif
+        goto ERR1;
+    } /* end of if (NULL == node) */
+    node->data = node->payload;
+    node->retire = NULL;
+    memcpy(node->data, data, lf->size);
+
+    /* 2.定位后用 CAS 发布, 前驱被修改或标记时重新定位 */
+    rec = __lf_enter(lf);
+    if (NULL == rec)
+    {
+        goto ERR2;
+    } /* end of if (NULL == rec) */
+    do
+    {
+        __lf_search(lf, rec, node->data, NULL, &prev, &cur);
+        node->next = cur;
+    } while (!__atomic_compare_exchange_n(prev, &cur, node, 0, __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+    __lf_exit(lf, rec);
+
+    __atomic_add_fetch(&lf->count, 1, __ATOMIC_RELAXED);
+
+    return 0;
+
+ERR0:
+    return PAR_ERROR;
+ERR2:
+    free(node);
+ERR1:
+    return FUN_ERROR;
+}
+
+
+/**
+ * @brief           根据关键字删除第一个匹配的节点
+ * @details         在三路比较函数判定相等的节点中, 删除第一个比较函数匹配的节点.
+ *                  自定义销毁函数在节点回收时调用
+ * @param           头信息结构体的指针
+ * @param           关键字
+ * @param           自定义比较函数
+ * @return          
+ *      @arg  0:正常
+ *      @arg  PAR_ERROR:参数错误
+ *      @arg  FUN_ERROR:函数错误(无匹配节点)
+ */
+int lflist_delete_by_key(lflist_t *lf, void *key, cmp_t op_cmp)
+{
+    void *rec = NULL;
+    lfnode_t **prev = NULL;
+    lfnode_t *cur = NULL;
+    lfnode_t *next = NULL;
+
+    /* 参数检查 */
+    if (NULL == lf || NULL == key || NULL == op_cmp)
+    {
+    #ifdef DEBUG
+        printf("lflist_delete_by_key: Parameter error\n");
+    #elif defined FILE_DEBUG
+        
+    #endif
+        goto ERR0;
+    } /* end of if (NULL == lf || NULL == key || NULL == op_cmp) */
+
+    rec = __lf_enter(lf);
+    if (NULL == rec)
+    {
+        goto ERR1;
+    } /* end of if (NULL == rec) */
+
+    /* 1.逻辑删除: 标记成功的线程完成删除, 节点已被其他线程标记时重新查找 */
+    do
+    {
+        if (!__lf_search(lf, rec, key, op_cmp, &prev, &cur))
+        {
+            goto ERR2;
+        } /* end of if (!__lf_search(lf, rec, key, op_cmp, &prev, &cur)) */
+        next = __atomic_load_n(&cur->next, __ATOMIC_ACQUIRE);
+    } while (__is_marked(next)
+             || !__atomic_compare_exchange_n(&cur->next, &next, __mark(next), 0, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED));
+
+    __atomic_sub_fetch(&lf->count, 1, __ATOMIC_RELAXED);
+
+    /* 2.物理摘除, 失败时由查找过程代为摘除 */
+    if (__atomic_compare_exchange_n(prev, &cur, next, 0, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED))
+    {
+        __lf_retire(lf, rec, cur);
+    }
+    else
+    {
+        __lf_search(lf, rec, key, op_cmp, &prev, &cur);
+    }
+    __lf_exit(lf, rec);
+
+    return 0;
+
+ERR0:
+    return PAR_ERROR;
+ERR2:
+    __lf_exit(lf, rec);
+ERR1:
+    return FUN_ERROR;
+}
+
+
+/**
+ * @brief           根据关键字获取第一个匹配节点的数据
+ * @param           头信息结构体的指针
+ * @param           获取的数据
+ * @param           关键字
+ * @param           自定义比较函数
+ * @return          
+ *      @arg  0:正常
+ *      @arg  PAR_ERROR:参数错误
+ *      @arg  FUN_ERROR:函数错误(无匹配节点)
+ */
+int lflist_retrieve_by_key(lflist_t *lf, void *data, void *key, cmp_t op_cmp)
+{
+    void *rec = NULL;
+    lfnode_t **prev = NULL;
+    lfnode_t *p = NULL;
+    lfnode_t *next = NULL;
+    int ret = 0;
+
+    /* 参数检查 */
+    if (NULL == lf || NULL == data || NULL == key || NULL == op_cmp)
+    {
+    #ifdef DEBUG
+        printf("lflist_retrieve_by_key: Parameter error\n");
+    #elif defined FILE_DEBUG
+        
+    #endif
+        goto ERR0;
+    } /* end of if (NULL == lf || NULL == data || NULL == key || NULL == op_cmp) */
+
+    rec = __lf_enter(lf);
+    if (NULL == rec)
+    {
+        goto ERR1;
+    } /* end of if (NULL == rec) */
+
+    /* 1.风险指针方式下不能越过已标记的节点, 由查找过程摘除 */
+    if (lf->flags & LFLIST_HAZARD)
+    {
+        ret = __lf_search(lf, rec, key, op_cmp, &prev, &p);
+        if (ret)
+        {
+            memcpy(data, p->data, lf->size);
+        } /* end of if (ret) */
+        __lf_exit(lf, rec);
+        return ret ? 0 : FUN_ERROR;
+    } /* end of if (lf->flags & LFLIST_HAZARD) */
+
+    /* 2.纪元回收方式下只读遍历, 跳过已标记删除的节点, 遇到大于关键字的节点时结束 */
+    for (p = __atomic_load_n(&lf->head, __ATOMIC_ACQUIRE); NULL != p; p = __unmark(next))
+    {
+        next = __atomic_load_n(&p->next, __ATOMIC_ACQUIRE);
+        ret = lf->my_order(p->data, key);
+        if (ret > 0)
+        {
+            break;
+        } /* end of if (ret > 0) */
+        if (0 == ret && !__is_marked(next) && MATCH_SUCCESS == op_cmp(p->data, key))
+        {
+            memcpy(data, p->data, lf->size);
+            __lf_exit(lf, rec);
+            return 0;
+        } /* end of if (0 == ret && !__is_marked(next) && ...) */
+    } /* end of for (p = ...; NULL != p; p = __unmark(next)) */
+    __lf_exit(lf, rec);
+
+    return FUN_ERROR;
+
+ERR0:
+    return PAR_ERROR;
+ERR1:
+    return FUN_ERROR;
+}
+
+
+/**
+ * @brief           获取链表中节点的个数
+ * @param           头信息结构体的指针
+ * @return          链表节点个数
+ *      @arg  PAR_ERROR:参数错误
+ */
+int lflist_get_count(lflist_t *lf)
+{
+    /* 参数检查 */
+    if (NULL == lf)
+    {
+    #ifdef DEBUG
+        printf("lflist_get_count: Parameter error\n");
+    #elif defined FILE_DEBUG
+        
+    #endif
+        return PAR_ERROR;
+    } /* end of if (NULL == lf) */
+
+    return __atomic_load_n(&lf->count, __ATOMIC_RELAXED);
+}
+
+
+/**
+ * @brief           遍历链表中未删除的节点
+ * @details         与其他线程的修改并发时, 结果为遍历过程中链表的某种中间状态.
+ *                  LFLIST_HAZARD 方式下当前节点被删除时从已打印的数据之后继续,
+ *                  可能遗漏与已打印数据相等的节点
+ * @param           头信息结构体的指针
+ * @param           自定义打印函数
+ * @return          
+ *      @arg  0:正常
+ *      @arg  PAR_ERROR:参数错误
+ *      @arg  FUN_ERROR:函数错误
+ */
+int lflist_traverse(lflist_t *lf, op_t my_print)
+{
+    void *rec = NULL;
+    lfnode_t **pp = NULL;
+    lfnode_t *p = NULL;
+    lfnode_t *next = NULL;
+    void *last = NULL;
+    int printed = 0;
+
+    /* 参数检查 */
+    if (NULL == lf || NULL == my_print)
+    {
+    #ifdef DEBUG
+        printf("lflist_traverse: Parameter error\n");
+    #elif defined FILE_DEBUG
+        
+    #endif
+        goto ERR0;
+    } /* end of if (NULL == lf || NULL == my_print) */
+
+    /* 风险指针方式下保存最后打印的数据, 用于重新定位 */
+    if (lf->flags & LFLIST_HAZARD)
+    {
+        last = malloc(lf->size);
+        if (NULL == last)
+        {
+        #ifdef DEBUG
+            printf("lflist_traverse: malloc error\n");
+        #elif defined FILE_DEBUG
+            
+        #endif
+            goto ERR1;
+        } /* end of if (NULL == last) */
+    } /* end of if (lf->flags & LFLIST_HAZARD) */
+
+    rec = __lf_enter(lf);
+    if (NULL == rec)
+    {
+        goto ERR2;
+    } /* end of if (NULL == rec) */
+
+    /* 1.从头开始, 或从最后打印的数据之后重新开始 */
+retry:
+    if (printed)
+    {
+        __lf_search(lf, rec, last, NULL, &pp, &p);
+    }
+    else
+    {
+        pp = &lf->head;
+        p = __atomic_load_n(pp, __ATOMIC_ACQUIRE);
+    }
+
+    /* 2.依次访问, 当前节点已不可访问时重新定位 */
+    while (NULL != p)
+    {
+        if (0 != __lf_protect(lf, rec, 1, p, pp))
+        {
+            goto retry;
+        } /* end of if (0 != __lf_protect(lf, rec, 1, p, pp)) */
+        next = __atomic_load_n(&p->next, __ATOMIC_ACQUIRE);
+        if (!__is_marked(next))
+        {
+            my_print(p->data);
+            if (NULL != last)
+            {
+                memcpy(last, p->data, lf->size);
+                printed = 1;
+            } /* end of if (NULL != last) */
+        } /* end of if (!__is_marked(next)) */
+
+        __lf_protect(lf, rec, 0, p, NULL);
+        pp = &p->next;
+        p = __unmark(next);
+    } /* end of while (NULL != p) */
+    __lf_exit(lf, rec);
+    free(last);
+
+    return 0;
+
+ERR0:
+    return PAR_ERROR;
+ERR2:
+    free(last);
+ERR1:
+    return FUN_ERROR;
+}
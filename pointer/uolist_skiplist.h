@@ -0,0 +1,87 @@
+/**
+ * @file                uolist_skiplist.h
+ * @brief               万能型单向链表的跳表索引
+ * @details             供 uni_oneway_linkedlist.c 在 UOLIST_SKIPLIST 模式下调用,
+ *                      调用者负责参数检查, 索引均已保证在有效范围内
+ * @author              BHR
+ * @version             v1.2
+ * @date                2026-10-16
+ * @copyright           MIT
+ */
+
+#ifndef __UOLIST_SKIPLIST_H__
+#define __UOLIST_SKIPLIST_H__
+
+#include "uni_oneway_linkedlist.h"
+
+
+/**
+ * @brief           创建跳表头索引节点
+ * @param           头信息结构体的指针
+ * @return
+ *      @arg  0:正常
+ *      @arg  FUN_ERROR:函数错误
+ */
+int skiplist_init(uolist_t *uo);
+
+
+/**
+ * @brief           释放全部索引节点(包括头索引节点)
+ * @param           头信息结构体的指针
+ * @return          0
+ */
+int skiplist_release(uolist_t *uo);
+
+
+/**
+ * @brief           索引失效时根据链表重建索引
+ * @param           头信息结构体的指针
+ * @return          0
+ */
+int skiplist_sync(uolist_t *uo);
+
+
+/**
+ * @brief           根据索引获取链表节点
+ * @param           头信息结构体的指针
+ * @param           索引值(0 <= index < count)
+ * @return          链表节点指针
+ */
+node_t *skiplist_at(uolist_t *uo, int index);
+
+
+/**
+ * @brief           在索引位置插入链表节点并维护索引
+ * @param           头信息结构体的指针
+ * @param           索引值(大于等于节点个数时插入到尾部)
+ * @param           要插入的链表节点
+ * @return          0
+ */
+int skiplist_link(uolist_t *uo, int index, node_t *p);
+
+
+/**
+ * @brief           摘除索引位置的链表节点并维护索引
+ * @param           头信息结构体的指针
+ * @param           索引值(0 <= index < count)
+ * @return          被摘除的链表节点(由调用者释放)
+ */
+node_t *skiplist_unlink(uolist_t *uo, int index);
+
+
+/**
+ * @brief           按三路比较函数定位(链表须有序, 索引须有效)
+ * @param           头信息结构体的指针
+ * @param           关键字
+ * @param           三路比较函数
+ * @param           为 0 时跳过小于关键字的节点, 否则跳过小于等于关键字的节点
+ * @param           保存返回索引节点排名的指针
+ * @return          最后一个被跳过的索引节点(没有时为头索引节点)
+ */
+sknode_t *skiplist_seek(uolist_t *uo, void *key, order_t my_order, int upper, int *rank);
+
+
+
+
+#endif /* __UOLIST_SKIPLIST_H__ */
+
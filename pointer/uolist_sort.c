@@ -0,0 +1,444 @@
+/**
+ * @file                uolist_sort.c
+ * @brief               万能型单向链表的排序
+ * @details             归并排序以链表中已有的非递减段(自然段)为初始归并单位,
+ *                      自底向上两两归并; 已基本有序的数据自然段很少, 完全有序时
+ *                      一次扫描即结束. 只使用常数额外空间.
+ *                      基数排序按关键字逐字节把节点分配到桶中, 只重新连接节点.
+ *                      多线程排序将链表切分后各段并行排序, 再并行两两归并
+ * @author              BHR
+ * @version             v1.2
+ * @date                2026-10-16
+ * @copyright           MIT
+ */
+
+#include <pthread.h>
+#include <unistd.h>
+#include "uolist_sort.h"
+
+// 归并暂存槽的个数(第 i 个槽约保存 2^i 个自然段)
+#define SORT_MAX_BIN 64
+
+// 基数排序每轮处理的位数(节点较多时每轮处理两个字节, 轮数减半)
+#define RADIX_BITS 8
+#define RADIX_BITS_LARGE 16
+
+// 多线程排序的最大线程数, 及每个线程至少处理的节点个数(更少时多线程得不偿失)
+#define SORT_MAX_THREAD 64
+#define SORT_MIN_SEGMENT 4096
+
+/**
+ * @brief 多线程排序的任务定义
+ * @details 排序任务只使用第一条链; 归并任务将第二条链归并到第一条链
+ */
+typedef struct _sort_task_t
+{
+    node_t *first;                  // 第一条链的第一个节点(保存结果)
+    node_t *last;                   // 第一条链的最后一个节点(保存结果)
+    node_t *first2;                 // 第二条链的第一个节点
+    node_t *last2;                  // 第二条链的最后一个节点
+    order_t my_order;               // 三路比较函数
+}sort_task_t;
+
+
+/**
+ * @brief           获取从指定节点开始的自然段的最后一个节点
+ * @param           段的第一个节点
+ * @param           三路比较函数
+ * @return          段的最后一个节点
+ */
+static node_t *__run_end(node_t *p, order_t my_order)
+{
+    while (NULL != p->next && my_order(p->data, p->next->data) <= 0)
+    {
+        p = p->next;
+    } /* end of while (NULL != p->next && my_order(p->data, p->next->data) <= 0) */
+
+    return p;
+}
+
+
+/**
+ * @brief           归并两条有序节点链(相等时前一条链的节点在前)
+ * @param           前一条有序节点链
+ * @param           前一条链的最后一个节点
+ * @param           后一条有序节点链
+ * @param           后一条链的最后一个节点
+ * @param           三路比较函数
+ * @param           保存归并后最后一个节点的指针
+ * @return          归并后的第一个节点
+ */
+static node_t *__chain_merge(node_t *a, node_t *a_last, node_t *b, node_t *b_last, order_t my_order, node_t **last)
+{
+    node_t head = {0};
+    node_t *t = &head;
+
+    while (NULL != a && NULL != b)
+    {
+        if (my_order(b->data, a->data) < 0)
+        {
+            t->next = b;
+            b = b->next;
+        }
+        else
+        {
+            t->next = a;
+            a = a->next;
+        }
+        t = t->next;
+    } /* end of while (NULL != a && NULL != b) */
+
+    /* 剩余部分整体接上 */
+    if (NULL != a)
+    {
+        t->next = a;
+        *last = a_last;
+    }
+    else
+    {
+        t->next = b;
+        *last = b_last;
+    }
+
+    return head.next;
+}
+
+
+/**
+ * @brief           对节点链进行自然归并排序
+ * @details         按二进制计数的方式归并: 第 i 个暂存槽保存约 2^i 个自然段
+ *                  归并后的结果, 新取出的段依次与低位槽归并并进位. 刚取出的
+ *                  数据尚在缓存中即参与归并, 槽数随 log n 增长, 额外空间为常数
+ * @param           节点链的第一个节点(不为 NULL)
+ * @param           三路比较函数
+ * @param           保存排序后最后一个节点的指针
+ * @return          排序后的第一个节点
+ */
+static node_t *__chain_sort(node_t *first, order_t my_order, node_t **last)
+{
+    node_t *bin[SORT_MAX_BIN] = {NULL};
+    node_t *bin_last[SORT_MAX_BIN] = {NULL};
+    node_t *run = NULL;
+    node_t *run_last = NULL;
+    node_t *p = first;
+    int top = 0;
+    int i = 0;
+
+    /* 1.依次取出自然段并进位归并 */
+    while (NULL != p)
+    {
+        run = p;
+        run_last = __run_end(p, my_order);
+        p = run_last->next;
+        run_last->next = NULL;
+
+        // 槽中的段位于链表中更靠前的位置, 作为归并的前一条链以保持稳定
+        for (i = 0; i < SORT_MAX_BIN - 1 && NULL != bin[i]; i++)
+        {
+            run = __chain_merge(bin[i], bin_last[i], run, run_last, my_order, &run_last);
+            bin[i] = NULL;
+        } /* end of for (i = 0; i < SORT_MAX_BIN - 1 && NULL != bin[i]; i++) */
+        if (NULL != bin[i])
+        {
+            run = __chain_merge(bin[i], bin_last[i], run, run_last, my_order, &run_last);
+        } /* end of if (NULL != bin[i]) */
+        bin[i] = run;
+        bin_last[i] = run_last;
+        if (i >= top)
+        {
+            top = i + 1;
+        } /* end of if (i >= top) */
+    } /* end of while (NULL != p) */
+
+    /* 2.由低位到高位归并全部槽 */
+    run = NULL;
+    run_last = NULL;
+    for (i = 0; i < top; i++)
+    {
+        if (NULL == bin[i])
+        {
+            continue;
+        } /* end of if (NULL == bin[i]) */
+        if (NULL == run)
+        {
+            run = bin[i];
+            run_last = bin_last[i];
+        }
+        else
+        {
+            run = __chain_merge(bin[i], bin_last[i], run, run_last, my_order, &run_last);
+        }
+    } /* end of for (i = 0; i < top; i++) */
+
+    *last = run_last;
+
+    return run;
+}
+
+
+/**
+ * @brief           排序任务的线程函数
+ * @param           任务指针
+ * @return          NULL
+ */
+static void *__sort_worker(void *arg)
+{
+    sort_task_t *task = (sort_task_t *)arg;
+
+    task->first = __chain_sort(task->first, task->my_order, &task->last);
+
+    return NULL;
+}
+
+
+/**
+ * @brief           归并任务的线程函数
+ * @param           任务指针
+ * @return          NULL
+ */
+static void *__merge_worker(void *arg)
+{
+    sort_task_t *task = (sort_task_t *)arg;
+
+    task->first = __chain_merge(task->first, task->last, task->first2, task->last2, task->my_order, &task->last);
+
+    return NULL;
+}
+
+
+/**
+ * @brief           并行执行一组任务, 全部完成后返回
+ * @details         第一个任务在调用线程中执行; 线程创建失败的任务也在调用线程中执行
+ * @param           任务数组
+ * @param           任务个数
+ * @param           线程函数
+ * @return          无
+ */
+static void __run_tasks(sort_task_t *task, int n, void *(*worker)(void *))
+{
+    pthread_t tid[SORT_MAX_THREAD];
+    int started[SORT_MAX_THREAD] = {0};
+    int i = 0;
+
+    for (i = 1; i < n; i++)
+    {
+        started[i] = (0 == pthread_create(&tid[i], NULL, worker, &task[i]));
+    } /* end of for (i = 1; i < n; i++) */
+
+    worker(&task[0]);
+    for (i = 1; i < n; i++)
+    {
+        if (started[i])
+        {
+            pthread_join(tid[i], NULL);
+        }
+        else
+        {
+            worker(&task[i]);
+        }
+    } /* end of for (i = 1; i < n; i++) */
+}
+
+
+
+/**
+ * @brief           自底向上的自然归并排序(稳定)
+ * @param           头信息结构体的指针
+ * @param           三路比较函数
+ * @return          0
+ */
+int sort_merge(uolist_t *uo, order_t my_order)
+{
+    if (uo->count < 2)
+    {
+        return 0;
+    } /* end of if (uo->count < 2) */
+
+    uo->fstnode_p = __chain_sort(uo->fstnode_p, my_order, &uo->lstnode_p);
+
+    return 0;
+}
+
+
+/**
+ * @brief           按字节的最低位优先基数排序(稳定)
+ * @param           头信息结构体的指针
+ * @param           自定义关键字提取函数
+ * @return
+ *      @arg  0:正常
+ *      @arg  FUN_ERROR:函数错误(链表不变)
+ */
+int sort_radix(uolist_t *uo, radix_t my_key)
+{
+    node_t **bucket = NULL;
+    node_t **bucket_last = NULL;
+    node_t *p = NULL;
+    node_t *t = NULL;
+    unsigned long long first = 0;
+    unsigned long long diff = 0;
+    unsigned long long mask = 0;
+    int bits = RADIX_BITS;
+    int shift = 0;
+    int b = 0;
+
+    if (uo->count < 2)
+    {
+        return 0;
+    } /* end of if (uo->count < 2) */
+
+    /* 1.按节点个数选择每轮的位数, 桶数远小于节点个数时分配的开销可以忽略 */
+    if (uo->count >= (1 << RADIX_BITS_LARGE))
+    {
+        bits = RADIX_BITS_LARGE;
+    } /* end of if (uo->count >= (1 << RADIX_BITS_LARGE)) */
+    mask = (1ULL << bits) - 1;
+    bucket = (node_t **)malloc(2 * ((size_t)1 << bits) * sizeof(node_t *));
+    if (NULL == bucket)
+    {
+    #ifdef DEBUG
+        printf("sort_radix: malloc error\n");
+    #elif defined FILE_DEBUG
+
+    #endif
+        return FUN_ERROR;
+    } /* end of if (NULL == bucket) */
+    bucket_last = bucket + ((size_t)1 << bits);
+
+    /* 2.找出所有关键字中不同的位, 相同的部分不需要处理 */
+    first = my_key(uo->fstnode_p->data);
+    for (p = uo->fstnode_p->next; NULL != p; p = p->next)
+    {
+        diff |= my_key(p->data) ^ first;
+    } /* end of for (p = uo->fstnode_p->next; NULL != p; p = p->next) */
+
+    /* 3.由低到高逐轮分配到桶中, 再按桶的顺序连接 */
+    for (shift = 0; shift < (int)sizeof(diff) * 8; shift += bits)
+    {
+        if (0 == ((diff >> shift) & mask))
+        {
+            continue;
+        } /* end of if (0 == ((diff >> shift) & mask)) */
+
+        memset(bucket, 0, ((size_t)1 << bits) * sizeof(node_t *));
+        for (p = uo->fstnode_p; NULL != p; p = p->next)
+        {
+            b = (int)((my_key(p->data) >> shift) & mask);
+            if (NULL == bucket[b])
+            {
+                bucket[b] = p;
+            }
+            else
+            {
+                bucket_last[b]->next = p;
+            }
+            bucket_last[b] = p;
+        } /* end of for (p = uo->fstnode_p; NULL != p; p = p->next) */
+
+        t = NULL;
+        for (b = 0; b <= (int)mask; b++)
+        {
+            if (NULL == bucket[b])
+            {
+                continue;
+            } /* end of if (NULL == bucket[b]) */
+            if (NULL == t)
+            {
+                uo->fstnode_p = bucket[b];
+            }
+            else
+            {
+                t->next = bucket[b];
+            }
+            t = bucket_last[b];
+        } /* end of for (b = 0; b <= (int)mask; b++) */
+        t->next = NULL;
+        uo->lstnode_p = t;
+    } /* end of for (shift = 0; shift < (int)sizeof(diff) * 8; shift += bits) */
+
+    free(bucket);
+
+    return 0;
+}
+
+
+/**
+ * @brief           多线程归并排序(稳定)
+ * @details         将链表切分为每个线程一段, 各段并行排序后按二叉树两两并行归并,
+ *                  每轮归并的任务数减半, 最后一次归并在调用线程中完成
+ * @param           头信息结构体的指针
+ * @param           三路比较函数(须可在多个线程中同时调用)
+ * @param           线程数(小于等于 0 时使用在线的处理器个数)
+ * @return          0
+ */
+int sort_parallel(uolist_t *uo, order_t my_order, int nthreads)
+{
+    sort_task_t seg[SORT_MAX_THREAD];
+    sort_task_t task[SORT_MAX_THREAD];
+    node_t *p = NULL;
+    int len = 0;
+    int step = 0;
+    int n = 0;
+    int i = 0;
+    int j = 0;
+
+    /* 1.确定线程数, 节点较少时退化为单线程排序 */
+    if (nthreads <= 0)
+    {
+        nthreads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    } /* end of if (nthreads <= 0) */
+    if (nthreads > SORT_MAX_THREAD)
+    {
+        nthreads = SORT_MAX_THREAD;
+    } /* end of if (nthreads > SORT_MAX_THREAD) */
+    if (nthreads > uo->count / SORT_MIN_SEGMENT)
+    {
+        nthreads = uo->count / SORT_MIN_SEGMENT;
+    } /* end of if (nthreads > uo->count / SORT_MIN_SEGMENT) */
+    if (nthreads <= 1)
+    {
+        return sort_merge(uo, my_order);
+    } /* end of if (nthreads <= 1) */
+
+    /* 2.切分为节点个数相近的各段 */
+    p = uo->fstnode_p;
+    for (i = 0; i < nthreads; i++)
+    {
+        len = uo->count / nthreads + (i < uo->count % nthreads);
+        seg[i].first = p;
+        seg[i].my_order = my_order;
+        for (j = 1; j < len; j++)
+        {
+            p = p->next;
+        } /* end of for (j = 1; j < len; j++) */
+        seg[i].last = p;
+        p = p->next;
+        seg[i].last->next = NULL;
+    } /* end of for (i = 0; i < nthreads; i++) */
+
+    /* 3.各段并行排序 */
+    __run_tasks(seg, nthreads, __sort_worker);
+
+    /* 4.相邻两段并行归并, 前一段在前以保持稳定 */
+    for (step = 1; step < nthreads; step *= 2)
+    {
+        for (i = 0, n = 0; i + step < nthreads; i += 2 * step, n++)
+        {
+            task[n] = seg[i];
+            task[n].first2 = seg[i + step].first;
+            task[n].last2 = seg[i + step].last;
+        } /* end of for (i = 0, n = 0; i + step < nthreads; i += 2 * step, n++) */
+
+        __run_tasks(task, n, __merge_worker);
+
+        for (i = 0, n = 0; i + step < nthreads; i += 2 * step, n++)
+        {
+            seg[i].first = task[n].first;
+            seg[i].last = task[n].last;
+        } /* end of for (i = 0, n = 0; i + step < nthreads; i += 2 * step, n++) */
+    } /* end of for (step = 1; step < nthreads; step *= 2) */
+
+    uo->fstnode_p = seg[0].first;
+    uo->lstnode_p = seg[0].last;
+
+    return 0;
+}
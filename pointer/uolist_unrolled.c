@@ -0,0 +1,837 @@
+/**
+ * @file                uolist_unrolled.c
+ * @brief               万能型单向链表的展开链表存储模式
+ * @details             每个展开节点连续存放多个数据, 遍历与查找在节点内
+ *                      顺序扫描, 每个数据分摊的指针开销也大幅降低
+ * @author              BHR
+ * @version             v1.2
+ * @date                2026-10-16
+ * @copyright           MIT
+ */
+
+#include "uolist_unrolled.h"
+
+/**
+ * @brief           获取展开节点中第 i 个数据的地址
+ * @param           链表头信息结构体指针
+ * @param           展开节点指针
+ * @param           节点内偏移
+ * @return          数据的地址
+ */
+static char *__elem(uolist_t *uo, unode_t *b, int i)
+{
+    return b->elems + (size_t)i * uo->size;
+}
+
+
+/**
+ * @brief           创建展开节点空间
+ * @param           链表头信息结构体指针
+ * @return          展开节点指针, 失败返回 NULL
+ */
+static unode_t *__unode_alloc(uolist_t *uo)
+{
+    unode_t *b = NULL;
+    int cap = 0;
+
+    /* 按目标大小计算每个节点存放的数据个数, 至少存放一个 */
+    cap = (UNROLL_BLOCK_SIZE - (int)sizeof(unode_t)) / uo->size;
+    if (cap < 1)
+    {
+        cap = 1;
+    } /* end of if (cap < 1) */
+
+    b = (unode_t *)malloc(sizeof(unode_t) + (size_t)cap * uo->size);
+    if (NULL == b)
+    {
+    #ifdef DEBUG
+        printf("__unode_alloc: malloc error\n");
+    #elif defined FILE_DEBUG
+        
+    #endif
+        return NULL;
+    } /* end of if (NULL == b) */
+
+    b->next = NULL;
+    b->fill = 0;
+    b->cap = cap;
+
+    return b;
+}
+
+
+/**
+ * @brief           将展开节点插入到指定前驱之后, 同时刷新头尾指针
+ * @param           链表头信息结构体指针
+ * @param           前驱节点(插入到链表头部时为 NULL)
+ * @param           要插入的展开节点
+ * @return          无
+ */
+static void __unode_link(uolist_t *uo, unode_t *prev, unode_t *b)
+{
+    if (NULL == prev)
+    {
+        b->next = uo->fstunode_p;
+        uo->fstunode_p = b;
+    }
+    else
+    {
+        b->next = prev->next;
+        prev->next = b;
+    }
+    if (uo->lstunode_p == prev)
+    {
+        uo->lstunode_p = b;
+    } /* end of if (uo->lstunode_p == prev) */
+}
+
+
+/**
+ * @brief           摘除并释放展开节点, 同时刷新头尾指针
+ * @param           链表头信息结构体指针
+ * @param           前驱节点(摘除第一个节点时为 NULL)
+ * @param           要摘除的展开节点
+ * @return          无
+ */
+static void __unode_unlink(uolist_t *uo, unode_t *prev, unode_t *b)
+{
+    if (NULL == prev)
+    {
+        uo->fstunode_p = b->next;
+    }
+    else
+    {
+        prev->next = b->next;
+    }
+    if (uo->lstunode_p == b)
+    {
+        uo->lstunode_p = prev;
+    } /* end of if (uo->lstunode_p == b) */
+
+    free(b);
+}
+
+
+/**
+ * @brief           根据索引定位展开节点
+ * @param           链表头信息结构体指针
+ * @param           索引值(0 <= index < count), 返回时为节点内偏移
+ * @param           保存前驱节点的指针, 为 NULL 时允许直接定位尾节点
+ * @return          展开节点指针
+ */
+static unode_t *__unode_locate(uolist_t *uo, int *index, unode_t **prev)
+{
+    unode_t *p = NULL;
+    unode_t *b = uo->fstunode_p;
+
+    /* 不需要前驱时, 尾节点中的数据直接定位 */
+    if (NULL == prev && *index >= uo->count - uo->lstunode_p->fill)
+    {
+        *index -= uo->count - uo->lstunode_p->fill;
+        return uo->lstunode_p;
+    } /* end of if (NULL == prev && *index >= uo->count - uo->lstunode_p->fill) */
+
+    while (*index >= b->fill)
+    {
+        *index -= b->fill;
+        p = b;
+        b = b->next;
+    } /* end of while (*index >= b->fill) */
+
+    if (NULL != prev)
+    {
+        *prev = p;
+    } /* end of if (NULL != prev) */
+
+    return b;
+}
+
+
+/**
+ * @brief           删除展开节点中的一个数据, 必要时合并或释放展开节点
+ * @param           链表头信息结构体指针
+ * @param           前驱节点
+ * @param           展开节点
+ * @param           节点内偏移
+ * @return          无
+ */
+static void __unode_remove(uolist_t *uo, unode_t *prev, unode_t *b, int off)
+{
+    unode_t *nb = NULL;
+
+    /* 1.销毁数据并前移后续数据 */
+    if (NULL != uo->my_destroy)
+    {
+        uo->my_destroy(__elem(uo, b, off));
+    } /* end of if (NULL != uo->my_destroy) */
+    memmove(__elem(uo, b, off), __elem(uo, b, off + 1), (size_t)(b->fill - off - 1) * uo->size);
+    b->fill--;
+    uo->count--;
+
+    /* 2.节点为空时释放 */
+    if (0 == b->fill)
+    {
+        __unode_unlink(uo, prev, b);
+        return;
+    } /* end of if (0 == b->fill) */
+
+    /* 3.节点不足半满且能容纳下一个节点时合并 */
+    nb = b->next;
+    if (NULL != nb && b->fill < b->cap / 2 && b->fill + nb->fill <= b->cap)
+    {
+        memcpy(__elem(uo, b, b->fill), nb->elems, (size_t)nb->fill * uo->size);
+        b->fill += nb->fill;
+        __unode_unlink(uo, b, nb);
+    } /* end of if (NULL != nb && b->fill < b->cap / 2 && b->fill + nb->fill <= b->cap) */
+}
+
+
+/**
+ * @brief           由连续数组构建装满的展开节点链
+ * @param           链表头信息结构体指针
+ * @param           连续存放的 n 个数据
+ * @param           数据个数(大于 0)
+ * @param           保存第一个展开节点的指针
+ * @param           保存最后一个展开节点的指针
+ * @return
+ *      @arg  0:正常
+ *      @arg  FUN_ERROR:函数错误
+ */
+static int __unode_chain(uolist_t *uo, char *data, int n, unode_t **first, unode_t **last)
+{
+    unode_t *head = NULL;
+    unode_t *tail = NULL;
+    unode_t *b = NULL;
+    int k = 0;
+
+    while (n > 0)
+    {
+        b = __unode_alloc(uo);
+        if (NULL == b)
+        {
+            goto ERR1;
+        } /* end of if (NULL == b) */
+
+        k = n < b->cap ? n : b->cap;
+        memcpy(b->elems, data, (size_t)k * uo->size);
+        b->fill = k;
+        data += (size_t)k * uo->size;
+        n -= k;
+
+        if (NULL == tail)
+        {
+            head = b;
+        }
+        else
+        {
+            tail->next = b;
+        }
+        tail = b;
+    } /* end of while (n > 0) */
+
+    *first = head;
+    *last = tail;
+
+    return 0;
+
+ERR1:
+    for (b = head; NULL != b; b = head)
+    {
+        head = b->next;
+        free(b);
+    } /* end of for (b = head; NULL != b; b = head) */
+    return FUN_ERROR;
+}
+
+
+/**
+ * @brief           在索引位置插入一个数据空间
+ * @param           头信息结构体的指针
+ * @param           索引值(大于等于节点个数时插入到尾部)
+ * @return          新数据空间的指针(未初始化), 失败返回 NULL
+ */
+void *unrolled_insert(uolist_t *uo, int index)
+{
+    unode_t *prev = NULL;
+    unode_t *b = NULL;
+    unode_t *nb = NULL;
+    int off = index;
+    int keep = 0;
+
+    /* 1.定位插入的展开节点及偏移 */
+    if (NULL == uo->fstunode_p)
+    {
+        b = __unode_alloc(uo);
+        if (NULL == b)
+        {
+            return NULL;
+        } /* end of if (NULL == b) */
+        __unode_link(uo, NULL, b);
+        off = 0;
+    }
+    else if (index >= uo->count)
+    {
+        b = uo->lstunode_p;
+        off = b->fill;
+    }
+    else
+    {
+        b = __unode_locate(uo, &off, &prev);
+    }
+
+    /* 2.展开节点已满时腾出空间 */
+    if (b->fill == b->cap)
+    {
+        if (0 == off && NULL != prev && prev->fill < prev->cap)
+        {
+            // 前一个节点尚有空间: 放到前一个节点末尾
+            b = prev;
+            off = b->fill;
+        }
+        else if (0 == off || off == b->cap)
+        {
+            // 插入到节点首尾: 新建节点, 不搬移已有数据
+            nb = __unode_alloc(uo);
+            if (NULL == nb)
+            {
+                return NULL;
+            } /* end of if (NULL == nb) */
+            __unode_link(uo, 0 == off ? prev : b, nb);
+            b = nb;
+            off = 0;
+        }
+        else
+        {
+            // 插入到节点中间: 对半拆分
+            nb = __unode_alloc(uo);
+            if (NULL == nb)
+            {
+                return NULL;
+            } /* end of if (NULL == nb) */
+            keep = b->fill - b->fill / 2;
+            memcpy(nb->elems, __elem(uo, b, keep), (size_t)(b->fill - keep) * uo->size);
+            nb->fill = b->fill - keep;
+            b->fill = keep;
+            __unode_link(uo, b, nb);
+            if (off > keep)
+            {
+                b = nb;
+                off -= keep;
+            } /* end of if (off > keep) */
+        }
+    } /* end of if (b->fill == b->cap) */
+
+    /* 3.后移数据, 腾出插入位置 */
+    memmove(__elem(uo, b, off + 1), __elem(uo, b, off), (size_t)(b->fill - off) * uo->size);
+    b->fill++;
+    uo->count++;
+
+    return __elem(uo, b, off);
+}
+
+
+/**
+ * @brief           删除索引位置的数据
+ * @param           头信息结构体的指针
+ * @param           索引值(0 <= index < count)
+ * @return          0
+ */
+int unrolled_delete(uolist_t *uo, int index)
+{
+    unode_t *prev = NULL;
+    unode_t *b = NULL;
+
+    b = __unode_locate(uo, &index, &prev);
+    __unode_remove(uo, prev, b, index);
+
+    return 0;
+}
+
+
+/**
+ * @brief           获取索引位置的数据
+ * @param           头信息结构体的指针
+ * @param           索引值(0 <= index < count)
+ * @return          数据的指针
+ */
+void *unrolled_at(uolist_t *uo, int index)
+{
+    unode_t *b = NULL;
+
+    b = __unode_locate(uo, &index, NULL);
+
+    return __elem(uo, b, index);
+}
+
+
+/**
+ * @brief           根据关键字查找第一个匹配的数据
+ * @param           头信息结构体的指针
+ * @param           关键字
+ * @param           自定义比较函数
+ * @param           保存匹配索引的指针, 可为 NULL
+ * @return          匹配数据的指针, 无匹配时返回 NULL
+ */
+void *unrolled_find(uolist_t *uo, void *key, cmp_t op_cmp, int *index)
+{
+    unode_t *b = NULL;
+    int base = 0;
+    int i = 0;
+
+    for (b = uo->fstunode_p; NULL != b; base += b->fill, b = b->next)
+    {
+        for (i = 0; i < b->fill; i++)
+        {
+            if (MATCH_SUCCESS == op_cmp(__elem(uo, b, i), key))
+            {
+                if (NULL != index)
+                {
+                    *index = base + i;
+                } /* end of if (NULL != index) */
+                return __elem(uo, b, i);
+            } /* end of if (MATCH_SUCCESS == op_cmp(__elem(uo, b, i), key)) */
+        } /* end of for (i = 0; i < b->fill; i++) */
+    } /* end of for (b = uo->fstunode_p; NULL != b; base += b->fill, b = b->next) */
+
+    return NULL;
+}
+
+
+/**
+ * @brief           根据关键字删除第一个匹配的数据
+ * @param           头信息结构体的指针
+ * @param           关键字
+ * @param           自定义比较函数
+ * @return
+ *      @arg  0:正常
+ *      @arg  FUN_ERROR:无匹配数据
+ */
+int unrolled_delete_by_key(uolist_t *uo, void *key, cmp_t op_cmp)
+{
+    unode_t *prev = NULL;
+    unode_t *b = NULL;
+    int i = 0;
+
+    for (b = uo->fstunode_p; NULL != b; prev = b, b = b->next)
+    {
+        for (i = 0; i < b->fill; i++)
+        {
+            if (MATCH_SUCCESS == op_cmp(__elem(uo, b, i), key))
+            {
+                __unode_remove(uo, prev, b, i);
+                return 0;
+            } /* end of if (MATCH_SUCCESS == op_cmp(__elem(uo, b, i), key)) */
+        } /* end of for (i = 0; i < b->fill; i++) */
+    } /* end of for (b = uo->fstunode_p; NULL != b; prev = b, b = b->next) */
+
+    return FUN_ERROR;
+}
+
+
+/**
+ * @brief           根据关键字删除所有匹配的数据(单次遍历)
+ * @param           头信息结构体的指针
+ * @param           关键字
+ * @param           自定义比较函数
+ * @return          删除的数据个数
+ */
+int unrolled_delete_all_by_key(uolist_t *uo, void *key, cmp_t op_cmp)
+{
+    unode_t *prev = NULL;
+    unode_t *b = NULL;
+    unode_t *save = NULL;
+    int num = 0;
+    int r = 0;
+    int w = 0;
+
+    for (b = uo->fstunode_p; NULL != b; b = save)
+    {
+        save = b->next;
+
+        /* 节点内压缩: 保留不匹配的数据 */
+        for (r = 0, w = 0; r < b->fill; r++)
+        {
+            if (MATCH_SUCCESS == op_cmp(__elem(uo, b, r), key))
+            {
+                if (NULL != uo->my_destroy)
+                {
+                    uo->my_destroy(__elem(uo, b, r));
+                } /* end of if (NULL != uo->my_destroy) */
+                num++;
+                continue;
+            } /* end of if (MATCH_SUCCESS == op_cmp(__elem(uo, b, r), key)) */
+
+            if (r != w)
+            {
+                memcpy(__elem(uo, b, w), __elem(uo, b, r), uo->size);
+            } /* end of if (r != w) */
+            w++;
+        } /* end of for (r = 0, w = 0; r < b->fill; r++) */
+        b->fill = w;
+
+        /* 空节点直接释放 */
+        if (0 == b->fill)
+        {
+            __unode_unlink(uo, prev, b);
+            continue;
+        } /* end of if (0 == b->fill) */
+        prev = b;
+    } /* end of for (b = uo->fstunode_p; NULL != b; b = save) */
+
+    uo->count -= num;
+
+    return num;
+}
+
+
+/**
+ * @brief           根据关键字修改所有匹配的数据(单次遍历)
+ * @param           头信息结构体的指针
+ * @param           修改的数据(为 NULL 时调用自定义更新函数)
+ * @param           关键字
+ * @param           自定义比较函数
+ * @param           自定义更新函数
+ * @return          修改的数据个数
+ */
+int unrolled_modify_all_by_key(uolist_t *uo, void *data, void *key, cmp_t op_cmp, op_t my_update)
+{
+    unode_t *b = NULL;
+    int num = 0;
+    int i = 0;
+
+    for (b = uo->fstunode_p; NULL != b; b = b->next)
+    {
+        for (i = 0; i < b->fill; i++)
+        {
+            if (MATCH_SUCCESS != op_cmp(__elem(uo, b, i), key))
+            {
+                continue;
+            } /* end of if (MATCH_SUCCESS != op_cmp(__elem(uo, b, i), key)) */
+
+            if (NULL != data)
+            {
+                memcpy(__elem(uo, b, i), data, uo->size);
+            }
+            else
+            {
+                my_update(__elem(uo, b, i));
+            }
+            num++;
+        } /* end of for (i = 0; i < b->fill; i++) */
+    } /* end of for (b = uo->fstunode_p; NULL != b; b = b->next) */
+
+    return num;
+}
+
+
+/**
+ * @brief           根据关键字查找所有匹配的索引, 依次尾插到索引链表
+ * @param           头信息结构体的指针
+ * @param           关键字
+ * @param           自定义比较函数
+ * @param           索引链表
+ * @return          0
+ */
+int unrolled_find_all_index(uolist_t *uo, void *key, cmp_t op_cmp, uolist_t *index_head)
+{
+    unode_t *b = NULL;
+    int index = 0;
+    int i = 0;
+
+    for (b = uo->fstunode_p; NULL != b; b = b->next)
+    {
+        for (i = 0; i < b->fill; i++, index++)
+        {
+            if (MATCH_SUCCESS == op_cmp(__elem(uo, b, i), key))
+            {
+                uolist_append(index_head, &index);
+            } /* end of if (MATCH_SUCCESS == op_cmp(__elem(uo, b, i), key)) */
+        } /* end of for (i = 0; i < b->fill; i++, index++) */
+    } /* end of for (b = uo->fstunode_p; NULL != b; b = b->next) */
+
+    return 0;
+}
+
+
+/**
+ * @brief           遍历所有数据
+ * @param           头信息结构体的指针
+ * @param           自定义打印数据函数
+ * @return          0
+ */
+int unrolled_traverse(uolist_t *uo, op_t my_print)
+{
+    unode_t *b = NULL;
+    int i = 0;
+
+    for (b = uo->fstunode_p; NULL != b; b = b->next)
+    {
+        for (i = 0; i < b->fill; i++)
+        {
+            my_print(__elem(uo, b, i));
+        } /* end of for (i = 0; i < b->fill; i++) */
+    } /* end of for (b = uo->fstunode_p; NULL != b; b = b->next) */
+
+    return 0;
+}
+
+
+/**
+ * @brief           销毁所有数据及展开节点
+ * @param           头信息结构体的指针
+ * @return          0
+ */
+int unrolled_destroy(uolist_t *uo)
+{
+    unode_t *b = NULL;
+    unode_t *save = NULL;
+    int i = 0;
+
+    for (b = uo->fstunode_p; NULL != b; b = save)
+    {
+        save = b->next;
+        for (i = 0; NULL != uo->my_destroy && i < b->fill; i++)
+        {
+            uo->my_destroy(__elem(uo, b, i));
+        } /* end of for (i = 0; NULL != uo->my_destroy && i < b->fill; i++) */
+        free(b);
+    } /* end of for (b = uo->fstunode_p; NULL != b; b = save) */
+
+    uo->fstunode_p = NULL;
+    uo->lstunode_p = NULL;
+    uo->count = 0;
+
+    return 0;
+}
+
+
+/**
+ * @brief           翻转链表
+ * @param           头信息结构体的指针
+ * @return          0
+ */
+int unrolled_reverse(uolist_t *uo)
+{
+    unode_t *b = NULL;
+    unode_t *save = NULL;
+    unode_t *head = NULL;
+    char *lo = NULL;
+    char *hi = NULL;
+    char c = 0;
+    int i = 0;
+    int j = 0;
+    int k = 0;
+
+    /* 翻转展开节点的顺序, 同时翻转每个节点内数据的顺序 */
+    uo->lstunode_p = uo->fstunode_p;
+    for (b = uo->fstunode_p; NULL != b; b = save)
+    {
+        save = b->next;
+
+        for (i = 0, j = b->fill - 1; i < j; i++, j--)
+        {
+            lo = __elem(uo, b, i);
+            hi = __elem(uo, b, j);
+            for (k = 0; k < uo->size; k++)
+            {
+                c = lo[k];
+                lo[k] = hi[k];
+                hi[k] = c;
+            } /* end of for (k = 0; k < uo->size; k++) */
+        } /* end of for (i = 0, j = b->fill - 1; i < j; i++, j--) */
+
+        b->next = head;
+        head = b;
+    } /* end of for (b = uo->fstunode_p; NULL != b; b = save) */
+    uo->fstunode_p = head;
+    uo->my_order = NULL;
+
+    return 0;
+}
+
+
+/**
+ * @brief           将全部数据依次导出到连续空间
+ * @param           头信息结构体的指针
+ * @param           导出空间(至少 count * size 字节)
+ * @return          0
+ */
+int unrolled_to_array(uolist_t *uo, void *buf)
+{
+    unode_t *b = NULL;
+    char *dst = (char *)buf;
+
+    for (b = uo->fstunode_p; NULL != b; b = b->next)
+    {
+        memcpy(dst, b->elems, (size_t)b->fill * uo->size);
+        dst += (size_t)b->fill * uo->size;
+    } /* end of for (b = uo->fstunode_p; NULL != b; b = b->next) */
+
+    return 0;
+}
+
+
+/**
+ * @brief           由连续数组批量尾部插入
+ * @param           头信息结构体的指针
+ * @param           连续存放的 n 个数据
+ * @param           数据个数
+ * @return
+ *      @arg  0:正常
+ *      @arg  FUN_ERROR:函数错误(链表不变)
+ */
+int unrolled_append_bulk(uolist_t *uo, void *data, int n)
+{
+    unode_t *first = NULL;
+    unode_t *last = NULL;
+    unode_t *tail = uo->lstunode_p;
+    int k = 0;
+
+    /* 1.尾节点剩余空间能容纳的个数 */
+    if (NULL != tail)
+    {
+        k = tail->cap - tail->fill;
+        k = n < k ? n : k;
+    } /* end of if (NULL != tail) */
+
+    /* 2.先构建剩余数据的节点链, 失败时链表不变 */
+    if (n > k && 0 != __unode_chain(uo, (char *)data + (size_t)k * uo->size, n - k, &first, &last))
+    {
+        return FUN_ERROR;
+    } /* end of if (n > k && 0 != __unode_chain(uo, ...)) */
+
+    /* 3.填满尾节点并接上节点链 */
+    if (k > 0)
+    {
+        memcpy(__elem(uo, tail, tail->fill), data, (size_t)k * uo->size);
+        tail->fill += k;
+    } /* end of if (k > 0) */
+    if (NULL != first)
+    {
+        if (NULL == tail)
+        {
+            uo->fstunode_p = first;
+        }
+        else
+        {
+            tail->next = first;
+        }
+        uo->lstunode_p = last;
+    } /* end of if (NULL != first) */
+    uo->count += n;
+
+    return 0;
+}
+
+
+/**
+ * @brief           由连续数组批量头部插入
+ * @param           头信息结构体的指针
+ * @param           连续存放的 n 个数据
+ * @param           数据个数
+ * @return
+ *      @arg  0:正常
+ *      @arg  FUN_ERROR:函数错误(链表不变)
+ */
+int unrolled_prepend_bulk(uolist_t *uo, void *data, int n)
+{
+    unode_t *first = NULL;
+    unode_t *last = NULL;
+
+    if (0 != __unode_chain(uo, (char *)data, n, &first, &last))
+    {
+        return FUN_ERROR;
+    } /* end of if (0 != __unode_chain(uo, (char *)data, n, &first, &last)) */
+
+    last->next = uo->fstunode_p;
+    uo->fstunode_p = first;
+    if (NULL == uo->lstunode_p)
+    {
+        uo->lstunode_p = last;
+    } /* end of if (NULL == uo->lstunode_p) */
+    uo->count += n;
+
+    return 0;
+}
+
+
+/**
+ * @brief           将源链表的全部展开节点接到目标链表尾部
+ * @param           目标链表头信息结构体的指针
+ * @param           源链表头信息结构体的指针(完成后为空)
+ * @return          0
+ */
+int unrolled_concat(uolist_t *dst, uolist_t *src)
+{
+    if (NULL == src->fstunode_p)
+    {
+        return 0;
+    } /* end of if (NULL == src->fstunode_p) */
+
+    if (NULL == dst->fstunode_p)
+    {
+        dst->fstunode_p = src->fstunode_p;
+    }
+    else
+    {
+        dst->lstunode_p->next = src->fstunode_p;
+    }
+    dst->lstunode_p = src->lstunode_p;
+    dst->count += src->count;
+
+    src->fstunode_p = NULL;
+    src->lstunode_p = NULL;
+    src->count = 0;
+
+    return 0;
+}
+
+
+/**
+ * @brief           从索引位置起的数据移到另一个空链表
+ * @details         只有索引所在的展开节点需要拆分(拷贝其中的后半部分数据),
+ *                  其后的展开节点整体移动
+ * @param           头信息结构体的指针
+ * @param           索引值(0 < index < count)
+ * @param           接收后半部分的空链表
+ * @return
+ *      @arg  0:正常
+ *      @arg  FUN_ERROR:函数错误(链表不变)
+ */
+int unrolled_split(uolist_t *uo, int index, uolist_t *dst)
+{
+    unode_t *prev = NULL;
+    unode_t *b = NULL;
+    unode_t *nb = NULL;
+    int off = index;
+
+    /* 1.定位索引所在的展开节点 */
+    b = __unode_locate(uo, &off, &prev);
+
+    /* 2.索引位于节点中间时拆分该节点 */
+    if (off > 0)
+    {
+        nb = __unode_alloc(uo);
+        if (NULL == nb)
+        {
+            return FUN_ERROR;
+        } /* end of if (NULL == nb) */
+
+        memcpy(nb->elems, __elem(uo, b, off), (size_t)(b->fill - off) * uo->size);
+        nb->fill = b->fill - off;
+        b->fill = off;
+        __unode_link(uo, b, nb);
+        prev = b;
+        b = nb;
+    } /* end of if (off > 0) */
+
+    /* 3.移动后续的全部展开节点 */
+    dst->fstunode_p = b;
+    dst->lstunode_p = uo->lstunode_p;
+    dst->count = uo->count - index;
+    prev->next = NULL;
+    uo->lstunode_p = prev;
+    uo->count = index;
+
+    return 0;
+}